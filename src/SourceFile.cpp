@@ -4,8 +4,11 @@
 
 #include "visualizer/DependencyGraphVisualizer.h"
 
+#include <iomanip>
+
 #include <llvm/IR/Module.h>
 #include <llvm/MC/TargetRegistry.h>
+#include <llvm/Support/raw_os_ostream.h>
 
 #include <ast/ASTBuilder.h>
 #include <exception/AntlrThrowingErrorListener.h>
@@ -292,13 +295,11 @@ void SourceFile::runTypeCheckerPost() { // NOLINT(misc-no-recursion)
   timer.stop();
   printStatusMessage("Type Checker Post", IO_AST, IO_AST, compilerOutput.times.typeCheckerPost, typeCheckerRuns);
 
-  // Save the JSON version in the compiler output
-  if (cliOptions.dumpSettings.dumpSymbolTable || cliOptions.testMode)
-    compilerOutput.symbolTableString = globalScope->getSymbolTableJSON().dump(/*indent=*/2);
-
   // Dump symbol table
-  if (cliOptions.dumpSettings.dumpSymbolTable)
-    dumpOutput(compilerOutput.symbolTableString, "Symbol Table", "symbol-table.json");
+  if (cliOptions.dumpSettings.dumpSymbolTable) {
+    const auto writeSymbolTable = [&](std::ostream &stream) { stream << std::setw(2) << globalScope->getSymbolTableJSON(); };
+    dumpOutput(writeSymbolTable, "Symbol Table", "symbol-table.json");
+  }
 }
 
 void SourceFile::runDependencyGraphVisualizer() {
@@ -347,13 +348,9 @@ void SourceFile::runIRGenerator() {
   IRGenerator irGenerator(resourceManager, this);
   irGenerator.visit(ast);
 
-  // Save the ir string in the compiler output
-  if (cliOptions.dumpSettings.dumpIR || cliOptions.testMode)
-    compilerOutput.irString = IRGenerator::getIRString(llvmModule.get(), cliOptions.testMode);
-
   // Dump unoptimized IR code
   if (cliOptions.dumpSettings.dumpIR)
-    dumpOutput(compilerOutput.irString, "Unoptimized IR Code", "ir-code.ll");
+    dumpIR(llvmModule.get(), "Unoptimized IR Code", "ir-code.ll");
 
   previousStage = IR_GENERATOR;
   timer.stop();
@@ -380,13 +377,9 @@ void SourceFile::runDefaultIROptimizer() {
   irOptimizer.prepare();
   irOptimizer.optimizeDefault();
 
-  // Save the optimized ir string in the compiler output
-  if (cliOptions.dumpSettings.dumpIR || cliOptions.testMode)
-    compilerOutput.irOptString = IRGenerator::getIRString(llvmModule.get(), cliOptions.testMode);
-
   // Dump optimized IR code
   if (cliOptions.dumpSettings.dumpIR)
-    dumpOutput(compilerOutput.irOptString, "Optimized IR Code", "ir-code-O" + std::to_string(optLevel) + ".ll");
+    dumpIR(llvmModule.get(), "Optimized IR Code", "ir-code-O" + std::to_string(optLevel) + ".ll");
 
   previousStage = IR_OPTIMIZER;
   timer.stop();
@@ -412,13 +405,9 @@ void SourceFile::runPreLinkIROptimizer() {
   irOptimizer.prepare();
   irOptimizer.optimizePreLink();
 
-  // Save the optimized ir string in the compiler output
-  if (cliOptions.dumpSettings.dumpIR || cliOptions.testMode)
-    compilerOutput.irOptString = IRGenerator::getIRString(llvmModule.get(), cliOptions.testMode);
-
   // Dump optimized IR code
   if (cliOptions.dumpSettings.dumpIR)
-    dumpOutput(compilerOutput.irOptString, "Optimized IR Code (pre-link)", "ir-code-lto-pre-link.ll");
+    dumpIR(llvmModule.get(), "Optimized IR Code (pre-link)", "ir-code-lto-pre-link.ll");
 
   timer.pause();
 }
@@ -467,15 +456,9 @@ void SourceFile::runPostLinkIROptimizer() {
   irOptimizer.prepare();
   irOptimizer.optimizePostLink();
 
-  // Save the optimized ir string in the compiler output
-  if (cliOptions.dumpSettings.dumpIR || cliOptions.testMode) {
-    llvm::Module *module = resourceManager.ltoModule.get();
-    compilerOutput.irOptString = IRGenerator::getIRString(module, cliOptions.testMode);
-  }
-
   // Dump optimized IR code
   if (cliOptions.dumpSettings.dumpIR)
-    dumpOutput(compilerOutput.irOptString, "Optimized IR Code (post-Link)", "ir-code-lto-post-link.ll");
+    dumpIR(resourceManager.ltoModule.get(), "Optimized IR Code (post-Link)", "ir-code-lto-post-link.ll");
 
   previousStage = IR_OPTIMIZER;
   timer.stop();
@@ -498,13 +481,10 @@ void SourceFile::runObjectEmitter() {
   std::filesystem::path objectFilePath = cliOptions.outputDir / filePath.filename();
   objectFilePath.replace_extension("o");
 
-  // Emit object for this source file
+  // Emit object for this source file. If the assembly string is requested, it is produced in the same codegen run
   const ObjectEmitter objectEmitter(resourceManager, this);
-  objectEmitter.emit(objectFilePath);
-
-  // Save assembly string in the compiler output
-  if (cliOptions.isNativeTarget && (cliOptions.dumpSettings.dumpAssembly || cliOptions.testMode))
-    objectEmitter.getASMString(compilerOutput.asmString);
+  const bool needsASMString = cliOptions.isNativeTarget && (cliOptions.dumpSettings.dumpAssembly || cliOptions.testMode);
+  objectEmitter.emit(objectFilePath, needsASMString ? &compilerOutput.asmString : nullptr);
 
   // Dump assembly code
   if (cliOptions.dumpSettings.dumpAssembly)
@@ -780,15 +760,24 @@ void SourceFile::mergeNameRegistries(const SourceFile &importedSourceFile, const
 }
 
 void SourceFile::dumpOutput(const std::string &content, const std::string &caption, const std::string &fileSuffix) const {
+  dumpOutput([&](std::ostream &stream) { stream << content; }, caption, fileSuffix);
+}
+
+void SourceFile::dumpOutput(const std::function<void(std::ostream &)> &writeContent, const std::string &caption,
+                            const std::string &fileSuffix) const {
   if (cliOptions.dumpSettings.dumpToFiles) {
     // Dump to file
     const std::string dumpFileName = filePath.stem().string() + "-" + fileSuffix;
     std::filesystem::path dumpFilePath = cliOptions.outputDir / dumpFileName;
     dumpFilePath.make_preferred();
-    FileUtil::writeToFile(dumpFilePath, content);
+    std::ofstream fileStream(dumpFilePath);
+    if (!fileStream)
+      throw CompilerError(IO_ERROR, "Failed to open file: " + dumpFilePath.string()); // GCOV_EXCL_LINE
+    writeContent(fileStream);
   } else {
     // Dump to console
-    std::cout << "\n" << caption << ":\n" << content;
+    std::cout << "\n" << caption << ":\n";
+    writeContent(std::cout);
   }
 
   // If the abort after dump is requested, set the abort compilation flag
@@ -803,6 +792,15 @@ void SourceFile::dumpOutput(const std::string &content, const std::string &capti
   }
 }
 
+void SourceFile::dumpIR(llvm::Module *module, const std::string &caption, const std::string &fileSuffix) const {
+  // Stream the IR straight to the output, without materializing the whole module as a string first
+  const auto writeIR = [&](std::ostream &stream) {
+    llvm::raw_os_ostream llvmStream(stream);
+    IRGenerator::printIR(llvmStream, module, cliOptions.testMode);
+  };
+  dumpOutput(writeIR, caption, fileSuffix);
+}
+
 void SourceFile::visualizerPreamble(std::stringstream &output) const {
   if (isMainFile)
     output << "digraph {\n rankdir=\"TB\";\n";
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 
 #include <ast/ASTNodes.h>
@@ -85,10 +86,7 @@ struct TimerOutput {
 struct CompilerOutput {
   std::string cstString;
   std::string astString;
-  std::string symbolTableString;
   std::string depGraphString;
-  std::string irString;
-  std::string irOptString;
   std::string asmString;
   std::string typesString;
   std::vector<CompilerWarning> warnings;
@@ -198,6 +196,9 @@ private:
   bool haveAllDependantsBeenTypeChecked() const;
   void mergeNameRegistries(const SourceFile &importedSourceFile, const std::string &importName);
   void dumpOutput(const std::string &content, const std::string &caption, const std::string &fileSuffix) const;
+  void dumpOutput(const std::function<void(std::ostream &)> &writeContent, const std::string &caption,
+                  const std::string &fileSuffix) const;
+  void dumpIR(llvm::Module *module, const std::string &caption, const std::string &fileSuffix) const;
   void visualizerPreamble(std::stringstream &output) const;
   void visualizerOutput(std::string outputName, const std::string &output) const;
   void printStatusMessage(const char *stage, const CompileStageIOType &in, const CompileStageIOType &out, uint64_t stageRuntime,
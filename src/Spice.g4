@@ -13,7 +13,7 @@ interfaceDef: topLevelDefAttr? qualifierLst? TYPE TYPE_IDENTIFIER (LESS typeLst
 enumDef: qualifierLst? TYPE TYPE_IDENTIFIER ENUM LBRACE enumItemLst RBRACE;
 genericTypeDef: TYPE TYPE_IDENTIFIER typeAltsLst SEMICOLON;
 aliasDef: qualifierLst? TYPE TYPE_IDENTIFIER ALIAS dataType SEMICOLON;
-globalVarDef: dataType TYPE_IDENTIFIER (ASSIGN constant)? SEMICOLON;
+globalVarDef: dataType TYPE_IDENTIFIER (ASSIGN (constant | fctCall))? SEMICOLON;
 extDecl: topLevelDefAttr? EXT (F LESS dataType GREATER | P) (IDENTIFIER | TYPE_IDENTIFIER) LPAREN (typeLst ELLIPSIS?)? RPAREN SEMICOLON;
 importDef: IMPORT STRING_LIT (AS IDENTIFIER)? SEMICOLON;
 
@@ -60,13 +60,16 @@ fallthroughStmt: FALLTHROUGH;
 assertStmt: ASSERT assignExpr SEMICOLON;
 
 // Builtin functions
-builtinCall: printfCall | sizeOfCall | alignOfCall | lenCall | panicCall | sysCall;
+builtinCall: printfCall | sizeOfCall | alignOfCall | lenCall | panicCall | sysCall | shuffleCall | reduceCall | atomicCall;
 printfCall: PRINTF LPAREN STRING_LIT (COMMA assignExpr)* RPAREN;
 sizeOfCall: SIZEOF LPAREN (assignExpr | TYPE dataType) RPAREN;
 alignOfCall: ALIGNOF LPAREN (assignExpr | TYPE dataType) RPAREN;
 lenCall: LEN LPAREN assignExpr RPAREN;
 panicCall: PANIC LPAREN assignExpr RPAREN;
 sysCall: SYSCALL LPAREN assignExpr (COMMA assignExpr)* RPAREN;
+shuffleCall: SHUFFLE LPAREN assignExpr (COMMA assignExpr)+ RPAREN;
+reduceCall: REDUCE LPAREN assignExpr COMMA (PLUS | MUL | BITWISE_AND | BITWISE_OR | BITWISE_XOR | LESS | GREATER) RPAREN;
+atomicCall: (ATOMIC_LOAD | ATOMIC_STORE | ATOMIC_EXCHANGE | ATOMIC_COMPARE_EXCHANGE | ATOMIC_FETCH_ADD) LPAREN assignExpr (COMMA assignExpr)* RPAREN;
 
 // Expression loop
 assignExpr: prefixUnaryExpr assignOp assignExpr | ternaryExpr;
@@ -156,6 +159,13 @@ ALIGNOF: 'alignof';
 LEN: 'len';
 PANIC: 'panic';
 SYSCALL: 'syscall';
+SHUFFLE: 'shuffle';
+REDUCE: 'reduce';
+ATOMIC_LOAD: 'atomicLoad';
+ATOMIC_STORE: 'atomicStore';
+ATOMIC_EXCHANGE: 'atomicExchange';
+ATOMIC_COMPARE_EXCHANGE: 'atomicCompareExchange';
+ATOMIC_FETCH_ADD: 'atomicFetchAdd';
 EXT: 'ext';
 TRUE: 'true';
 FALSE: 'false';
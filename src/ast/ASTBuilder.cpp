@@ -273,6 +273,9 @@ std::any ASTBuilder::visitGlobalVarDef(SpiceParser::GlobalVarDefContext *ctx) {
   if (ctx->constant()) {
     globalVarDefNode->hasValue = true;
     globalVarDefNode->constant = std::any_cast<ConstantNode *>(visit(ctx->constant()));
+  } else if (ctx->fctCall()) {
+    globalVarDefNode->hasValue = true;
+    globalVarDefNode->fctCall = std::any_cast<FctCallNode *>(visit(ctx->fctCall()));
   }
 
   return concludeNode(globalVarDefNode);
@@ -882,6 +885,12 @@ std::any ASTBuilder::visitBuiltinCall(SpiceParser::BuiltinCallContext *ctx) {
     builtinCallNode->panicCall = std::any_cast<PanicCallNode *>(visit(ctx->panicCall()));
   } else if (ctx->sysCall()) {
     builtinCallNode->sysCall = std::any_cast<SysCallNode *>(visit(ctx->sysCall()));
+  } else if (ctx->shuffleCall()) {
+    builtinCallNode->shuffleCall = std::any_cast<ShuffleCallNode *>(visit(ctx->shuffleCall()));
+  } else if (ctx->reduceCall()) {
+    builtinCallNode->reduceCall = std::any_cast<ReduceCallNode *>(visit(ctx->reduceCall()));
+  } else if (ctx->atomicCall()) {
+    builtinCallNode->atomicCall = std::any_cast<AtomicCallNode *>(visit(ctx->atomicCall()));
   } else {
     assert_fail("Unknown builtin call"); // GCOV_EXCL_LINE
   }
@@ -959,6 +968,67 @@ std::any ASTBuilder::visitSysCall(SpiceParser::SysCallContext *ctx) {
   return concludeNode(sysCallNode);
 }
 
+std::any ASTBuilder::visitShuffleCall(SpiceParser::ShuffleCallContext *ctx) {
+  const auto shuffleCallNode = createNode<ShuffleCallNode>(ctx);
+
+  // Visit children
+  shuffleCallNode->vector = std::any_cast<AssignExprNode *>(visit(ctx->assignExpr().front()));
+  for (size_t i = 1; i < ctx->assignExpr().size(); i++)
+    shuffleCallNode->indices.push_back(std::any_cast<AssignExprNode *>(visit(ctx->assignExpr().at(i))));
+
+  return concludeNode(shuffleCallNode);
+}
+
+std::any ASTBuilder::visitReduceCall(SpiceParser::ReduceCallContext *ctx) {
+  const auto reduceCallNode = createNode<ReduceCallNode>(ctx);
+
+  // Enrich
+  if (ctx->PLUS())
+    reduceCallNode->op = ReduceCallNode::ReduceOp::OP_ADD;
+  else if (ctx->MUL())
+    reduceCallNode->op = ReduceCallNode::ReduceOp::OP_MUL;
+  else if (ctx->BITWISE_AND())
+    reduceCallNode->op = ReduceCallNode::ReduceOp::OP_BITWISE_AND;
+  else if (ctx->BITWISE_OR())
+    reduceCallNode->op = ReduceCallNode::ReduceOp::OP_BITWISE_OR;
+  else if (ctx->BITWISE_XOR())
+    reduceCallNode->op = ReduceCallNode::ReduceOp::OP_BITWISE_XOR;
+  else if (ctx->LESS())
+    reduceCallNode->op = ReduceCallNode::ReduceOp::OP_MIN;
+  else if (ctx->GREATER())
+    reduceCallNode->op = ReduceCallNode::ReduceOp::OP_MAX;
+  else
+    assert_fail("Invalid reduce operator"); // GCOV_EXCL_LINE
+
+  // Visit children
+  reduceCallNode->vector = std::any_cast<AssignExprNode *>(visit(ctx->assignExpr()));
+
+  return concludeNode(reduceCallNode);
+}
+
+std::any ASTBuilder::visitAtomicCall(SpiceParser::AtomicCallContext *ctx) {
+  const auto atomicCallNode = createNode<AtomicCallNode>(ctx);
+
+  // Enrich
+  if (ctx->ATOMIC_LOAD())
+    atomicCallNode->op = AtomicCallNode::AtomicOp::OP_LOAD;
+  else if (ctx->ATOMIC_STORE())
+    atomicCallNode->op = AtomicCallNode::AtomicOp::OP_STORE;
+  else if (ctx->ATOMIC_EXCHANGE())
+    atomicCallNode->op = AtomicCallNode::AtomicOp::OP_EXCHANGE;
+  else if (ctx->ATOMIC_COMPARE_EXCHANGE())
+    atomicCallNode->op = AtomicCallNode::AtomicOp::OP_COMPARE_EXCHANGE;
+  else if (ctx->ATOMIC_FETCH_ADD())
+    atomicCallNode->op = AtomicCallNode::AtomicOp::OP_FETCH_ADD;
+  else
+    assert_fail("Invalid atomic operation"); // GCOV_EXCL_LINE
+
+  // Visit children
+  fetchChildrenIntoVector(atomicCallNode->args, ctx->assignExpr());
+
+  return concludeNode(atomicCallNode);
+}
+
 std::any ASTBuilder::visitAssignExpr(SpiceParser::AssignExprContext *ctx) {
   const auto assignExprNode = createNode<AssignExprNode>(ctx);
 
@@ -1786,8 +1856,9 @@ void ASTBuilder::replaceEscapeChars(std::string &input) {
 std::string ASTBuilder::getIdentifier(TerminalNode *terminal) const {
   std::string identifier = terminal->getText();
 
-  // Check if the identifier is 'String' and this is no std source file
-  bool isReserved = !sourceFile->isStdFile && (identifier == STROBJ_NAME || identifier == RESULTOBJ_NAME);
+  // Check if the identifier is a builtin type name and this is no std source file
+  const bool isBuiltinTypeName = identifier == STROBJ_NAME || identifier == STRVIEWOBJ_NAME || identifier == RESULTOBJ_NAME;
+  bool isReserved = !sourceFile->isStdFile && isBuiltinTypeName;
   // Check if the list of reserved keywords contains the given identifier
   isReserved |= std::ranges::find(RESERVED_KEYWORDS, identifier) != std::end(RESERVED_KEYWORDS);
   // Print error message
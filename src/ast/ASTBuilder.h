@@ -96,6 +96,9 @@ public:
   std::any visitLenCall(SpiceParser::LenCallContext *ctx) override;
   std::any visitPanicCall(SpiceParser::PanicCallContext *ctx) override;
   std::any visitSysCall(SpiceParser::SysCallContext *ctx) override;
+  std::any visitShuffleCall(SpiceParser::ShuffleCallContext *ctx) override;
+  std::any visitReduceCall(SpiceParser::ReduceCallContext *ctx) override;
+  std::any visitAtomicCall(SpiceParser::AtomicCallContext *ctx) override;
   std::any visitAssignExpr(SpiceParser::AssignExprContext *ctx) override;
   std::any visitTernaryExpr(SpiceParser::TernaryExprContext *ctx) override;
   std::any visitLogicalOrExpr(SpiceParser::LogicalOrExprContext *ctx) override;
@@ -72,7 +72,10 @@ bool FctDefBaseNode::returnsOnAllControlPaths(bool *doSetPredecessorsUnreachable
   return body->returnsOnAllControlPaths(doSetPredecessorsUnreachable);
 }
 
-CompileTimeValue GlobalVarDefNode::getCompileTimeValue() const { return constant->getCompileTimeValue(); }
+CompileTimeValue GlobalVarDefNode::getCompileTimeValue() const {
+  assert(hasCompileTimeValue());
+  return constant ? constant->getCompileTimeValue() : computedValue;
+}
 
 bool ForLoopNode::returnsOnAllControlPaths(bool *doSetPredecessorsUnreachable) const {
   // If we have the guarantee that the loop condition is always true and the loop body returns on all control paths,
@@ -529,16 +529,19 @@ public:
   std::any accept(ParallelizableASTVisitor *visitor) const override { return visitor->visitGlobalVarDef(this); }
 
   // Other methods
-  [[nodiscard]] bool hasCompileTimeValue() const override { return true; }
+  [[nodiscard]] bool hasCompileTimeValue() const override { return constant || isValueComputed; }
   [[nodiscard]] CompileTimeValue getCompileTimeValue() const override;
 
   // Other methods
-  GET_CHILDREN(dataType, constant);
+  GET_CHILDREN(dataType, constant, fctCall);
 
   // Public members
   DataTypeNode *dataType = nullptr;
   ConstantNode *constant = nullptr;
+  FctCallNode *fctCall = nullptr;
+  CompileTimeValue computedValue;
   bool hasValue = false;
+  bool isValueComputed = false;
   std::string varName;
   SymbolTableEntry *entry = nullptr;
 };
@@ -1387,7 +1390,7 @@ public:
   std::any accept(ParallelizableASTVisitor *visitor) const override { return visitor->visitBuiltinCall(this); }
 
   // Other methods
-  GET_CHILDREN(printfCall, sizeofCall, alignofCall, lenCall, panicCall, sysCall);
+  GET_CHILDREN(printfCall, sizeofCall, alignofCall, lenCall, panicCall, sysCall, shuffleCall, reduceCall, atomicCall);
 
   // Public members
   PrintfCallNode *printfCall = nullptr;
@@ -1396,6 +1399,9 @@ public:
   LenCallNode *lenCall = nullptr;
   PanicCallNode *panicCall = nullptr;
   SysCallNode *sysCall = nullptr;
+  ShuffleCallNode *shuffleCall = nullptr;
+  ReduceCallNode *reduceCall = nullptr;
+  AtomicCallNode *atomicCall = nullptr;
 };
 
 // ======================================================== PrintfCallNode =======================================================
@@ -1523,6 +1529,87 @@ public:
   std::vector<AssignExprNode *> args;
 };
 
+// ======================================================= ShuffleCallNode =======================================================
+
+class ShuffleCallNode final : public ExprNode {
+public:
+  // Constructors
+  using ExprNode::ExprNode;
+
+  // Visitor methods
+  std::any accept(AbstractASTVisitor *visitor) override { return visitor->visitShuffleCall(this); }
+  std::any accept(ParallelizableASTVisitor *visitor) const override { return visitor->visitShuffleCall(this); }
+
+  // Other methods
+  GET_CHILDREN(vector, indices);
+  [[nodiscard]] bool hasCompileTimeValue() const override { return false; }
+
+  // Public members
+  AssignExprNode *vector = nullptr;
+  std::vector<AssignExprNode *> indices;
+  std::vector<int> laneIndices;
+};
+
+// ======================================================= ReduceCallNode ========================================================
+
+class ReduceCallNode final : public ExprNode {
+public:
+  // Enums
+  enum class ReduceOp : uint8_t {
+    OP_ADD,
+    OP_MUL,
+    OP_BITWISE_AND,
+    OP_BITWISE_OR,
+    OP_BITWISE_XOR,
+    OP_MIN,
+    OP_MAX,
+  };
+
+  // Constructors
+  using ExprNode::ExprNode;
+
+  // Visitor methods
+  std::any accept(AbstractASTVisitor *visitor) override { return visitor->visitReduceCall(this); }
+  std::any accept(ParallelizableASTVisitor *visitor) const override { return visitor->visitReduceCall(this); }
+
+  // Other methods
+  GET_CHILDREN(vector);
+  [[nodiscard]] bool hasCompileTimeValue() const override { return false; }
+
+  // Public members
+  AssignExprNode *vector = nullptr;
+  ReduceOp op = ReduceOp::OP_ADD;
+};
+
+// ======================================================= AtomicCallNode ========================================================
+
+class AtomicCallNode final : public ExprNode {
+public:
+  // Enums
+  enum class AtomicOp : uint8_t {
+    OP_LOAD,
+    OP_STORE,
+    OP_EXCHANGE,
+    OP_COMPARE_EXCHANGE,
+    OP_FETCH_ADD,
+  };
+
+  // Constructors
+  using ExprNode::ExprNode;
+
+  // Visitor methods
+  std::any accept(AbstractASTVisitor *visitor) override { return visitor->visitAtomicCall(this); }
+  std::any accept(ParallelizableASTVisitor *visitor) const override { return visitor->visitAtomicCall(this); }
+
+  // Other methods
+  GET_CHILDREN(args);
+  [[nodiscard]] bool hasCompileTimeValue() const override { return false; }
+
+  // Public members
+  std::vector<AssignExprNode *> args;
+  AtomicOp op = AtomicOp::OP_LOAD;
+};
+
 // ======================================================= AssignExprNode ========================================================
 
 class AssignExprNode final : public ExprNode {
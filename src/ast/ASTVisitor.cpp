@@ -116,6 +116,12 @@ std::any ASTVisitor::visitPanicCall(PanicCallNode *node) { return visitChildren(
 
 std::any ASTVisitor::visitSysCall(SysCallNode *node) { return visitChildren(node); }
 
+std::any ASTVisitor::visitShuffleCall(ShuffleCallNode *node) { return visitChildren(node); }
+
+std::any ASTVisitor::visitReduceCall(ReduceCallNode *node) { return visitChildren(node); }
+
+std::any ASTVisitor::visitAtomicCall(AtomicCallNode *node) { return visitChildren(node); }
+
 std::any ASTVisitor::visitAssignExpr(AssignExprNode *node) { return visitChildren(node); }
 
 std::any ASTVisitor::visitTernaryExpr(TernaryExprNode *node) { return visitChildren(node); }
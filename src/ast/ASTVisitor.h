@@ -66,6 +66,9 @@ public:
   std::any visitLenCall(LenCallNode *node) override;
   std::any visitPanicCall(PanicCallNode *node) override;
   std::any visitSysCall(SysCallNode *node) override;
+  std::any visitShuffleCall(ShuffleCallNode *node) override;
+  std::any visitReduceCall(ReduceCallNode *node) override;
+  std::any visitAtomicCall(AtomicCallNode *node) override;
   std::any visitAssignExpr(AssignExprNode *node) override;
   std::any visitTernaryExpr(TernaryExprNode *node) override;
   std::any visitLogicalOrExpr(LogicalOrExprNode *node) override;
@@ -63,6 +63,9 @@ class AlignofCallNode;
 class LenCallNode;
 class PanicCallNode;
 class SysCallNode;
+class ShuffleCallNode;
+class ReduceCallNode;
+class AtomicCallNode;
 class AssignExprNode;
 class TernaryExprNode;
 class LogicalOrExprNode;
@@ -157,6 +160,9 @@ public:
   virtual std::any visitLenCall(LenCallNode *node) = 0;
   virtual std::any visitPanicCall(PanicCallNode *node) = 0;
   virtual std::any visitSysCall(SysCallNode *node) = 0;
+  virtual std::any visitShuffleCall(ShuffleCallNode *node) = 0;
+  virtual std::any visitReduceCall(ReduceCallNode *node) = 0;
+  virtual std::any visitAtomicCall(AtomicCallNode *node) = 0;
   virtual std::any visitAssignExpr(AssignExprNode *node) = 0;
   virtual std::any visitTernaryExpr(TernaryExprNode *node) = 0;
   virtual std::any visitLogicalOrExpr(LogicalOrExprNode *node) = 0;
@@ -22,6 +22,7 @@ static constexpr const char *const ATTR_CORE_COMPILER_FIXED_TYPE_ID = "core.comp
 static constexpr const char *const ATTR_CORE_COMPILER_EMIT_VTABLE = "core.compiler.alwaysEmitVTable";
 static constexpr const char *const ATTR_CORE_COMPILER_PACKED = "core.compiler.packed";
 static constexpr const char *const ATTR_CORE_COMPILER_WARNINGS_IGNORE = "core.compiler.warnings.ignore";
+static constexpr const char *const ATTR_CORE_COMPILER_COMPILE_TIME = "core.compiler.compileTime";
 static constexpr const char *const ATTR_TEST = "test";
 static constexpr const char *const ATTR_TEST_NAME = "test.name";
 static constexpr const char *const ATTR_TEST_SKIP = "test.skip";
@@ -129,6 +130,13 @@ static const std::unordered_map<std::string, AttrConfigValue> ATTR_CONFIGS = {
             .type = AttrNode::AttrType::TYPE_BOOL,
         },
     },
+    {
+        ATTR_CORE_COMPILER_COMPILE_TIME,
+        {
+            .target = AttrNode::AttrTarget::TARGET_FCT_PROC,
+            .type = AttrNode::AttrType::TYPE_BOOL,
+        },
+    },
     {
         ATTR_TEST,
         {
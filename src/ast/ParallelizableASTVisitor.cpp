@@ -127,6 +127,12 @@ std::any ParallelizableASTVisitor::visitPanicCall(const PanicCallNode *node) { r
 
 std::any ParallelizableASTVisitor::visitSysCall(const SysCallNode *node) { return visitChildren(node); }
 
+std::any ParallelizableASTVisitor::visitShuffleCall(const ShuffleCallNode *node) { return visitChildren(node); }
+
+std::any ParallelizableASTVisitor::visitReduceCall(const ReduceCallNode *node) { return visitChildren(node); }
+
+std::any ParallelizableASTVisitor::visitAtomicCall(const AtomicCallNode *node) { return visitChildren(node); }
+
 std::any ParallelizableASTVisitor::visitAssignExpr(const AssignExprNode *node) { return visitChildren(node); }
 
 std::any ParallelizableASTVisitor::visitTernaryExpr(const TernaryExprNode *node) { return visitChildren(node); }
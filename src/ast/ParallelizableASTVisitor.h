@@ -63,6 +63,9 @@ class AlignofCallNode;
 class LenCallNode;
 class PanicCallNode;
 class SysCallNode;
+class ShuffleCallNode;
+class ReduceCallNode;
+class AtomicCallNode;
 class AssignExprNode;
 class TernaryExprNode;
 class LogicalOrExprNode;
@@ -157,6 +160,9 @@ public:
   virtual std::any visitLenCall(const LenCallNode *node);
   virtual std::any visitPanicCall(const PanicCallNode *node);
   virtual std::any visitSysCall(const SysCallNode *node);
+  virtual std::any visitShuffleCall(const ShuffleCallNode *node);
+  virtual std::any visitReduceCall(const ReduceCallNode *node);
+  virtual std::any visitAtomicCall(const AtomicCallNode *node);
   virtual std::any visitAssignExpr(const AssignExprNode *node);
   virtual std::any visitTernaryExpr(const TernaryExprNode *node);
   virtual std::any visitLogicalOrExpr(const LogicalOrExprNode *node);
@@ -160,6 +160,18 @@ void Driver::enrich() {
   if (cliOptions.dumpSettings.dumpIR)
     cliOptions.namesForIRValues = true;
 
+  // Lifetime markers are required to share stack slots between variables. This is only worth it for optimized builds
+  if (cliOptions.optLevel > O0)
+    cliOptions.useLifetimeMarkers = true;
+
+  // Check if the PGO settings are valid
+  if (cliOptions.pgoInstrGen || !cliOptions.pgoProfileUsePath.empty()) {
+    if (cliOptions.pgoInstrGen && !cliOptions.pgoProfileUsePath.empty())
+      throw CliError(INVALID_PGO_CONFIG, "Instrumentation and profile usage cannot be combined in one build");
+    if (cliOptions.optLevel == O0)
+      throw CliError(INVALID_PGO_CONFIG, "Profile-guided optimization requires an optimization level of O1 or higher");
+  }
+
   // Enable test mode when test mode was selected
   if (cliOptions.buildMode == TEST) {
     cliOptions.testMode = true;
@@ -227,6 +239,13 @@ void Driver::addBuildSubcommand() {
   // --abort-after-dump
   subCmd->add_flag<bool>("--abort-after-dump", cliOptions.dumpSettings.abortAfterDump,
                          "Abort the compilation process after dumping the first requested resource");
+  // --pgo-instr-gen
+  subCmd->add_flag<bool>("--pgo-instr-gen", cliOptions.pgoInstrGen,
+                         "Instrument the executable to collect profile data for profile-guided optimization");
+  // --pgo-use
+  subCmd->add_option<std::filesystem::path>("--pgo-use", cliOptions.pgoProfileUsePath,
+                                            "Use the given profile data (.profdata) for profile-guided optimization")
+      ->check(CLI::ExistingFile);
 }
 
 /**
@@ -336,7 +355,7 @@ void Driver::addCompileSubcommandOptions(CLI::App *subCmd) {
   subCmd->add_flag<bool>("--ignore-cache", cliOptions.ignoreCache, "Force re-compilation of all source files");
   // --use-lifetime-markers
   subCmd->add_flag<bool>("--use-lifetime-markers", cliOptions.useLifetimeMarkers,
-                         "Generate lifetime markers to enhance optimizations");
+                         "Generate lifetime markers to enhance optimizations (always enabled for O1 and above)");
 
   // Opt levels
   subCmd->add_flag_callback("-O0", [&] { cliOptions.optLevel = O0; }, "Disable optimization for the output executable.");
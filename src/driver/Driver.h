@@ -65,6 +65,8 @@ struct CliOptions {
   bool useLifetimeMarkers = false;
   OptLevel optLevel = O0; // Default optimization level for debug build mode is O0
   bool useLTO = false;
+  bool pgoInstrGen = false;                // Instrument the output executable to collect profile data
+  std::filesystem::path pgoProfileUsePath; // Use the given profile data for optimization, if set
   bool noEntryFct = false;
   bool generateTestMain = false;
   bool staticLinking = false;
@@ -41,6 +41,8 @@ std::string CliError::getMessagePrefix(CliErrorType errorType) {
     return "Feature not supported when dockerized";
   case INVALID_BUILD_MODE:
     return "Invalid build mode";
+  case INVALID_PGO_CONFIG:
+    return "Invalid PGO configuration";
   case COMING_SOON_CLI:
     return "Coming soon";
   }
@@ -18,6 +18,7 @@ enum CliErrorType : uint8_t {
   NON_ZERO_EXIT_CODE,
   FEATURE_NOT_SUPPORTED_WHEN_DOCKERIZED,
   INVALID_BUILD_MODE,
+  INVALID_PGO_CONFIG,
   COMING_SOON_CLI,
 };
 
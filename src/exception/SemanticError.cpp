@@ -174,6 +174,16 @@ std::string SemanticError::getMessagePrefix(SemanticErrorType errorType) {
     return "Syscall number out of range";
   case TOO_MANY_SYSCALL_ARGS:
     return "Too many syscall args";
+  case INVALID_SIMD_VECTOR:
+    return "Invalid SIMD vector";
+  case INVALID_SHUFFLE_INDEX:
+    return "Invalid shuffle index";
+  case ATOMIC_ARG_COUNT_ERROR:
+    return "Atomic arg number mismatch";
+  case INVALID_ATOMIC_TYPE:
+    return "Invalid atomic type";
+  case INVALID_MEMORY_ORDER:
+    return "Invalid memory order";
   case RETURN_WITHOUT_VALUE_RESULT:
     return "Return without initialization of result variable";
   case RETURN_WITH_VALUE_IN_PROCEDURE:
@@ -236,6 +246,10 @@ std::string SemanticError::getMessagePrefix(SemanticErrorType errorType) {
     return "Test function with parameters";
   case TEST_FUNCTION_WRONG_RETURN_TYPE:
     return "Test function with wrong return type";
+  case INVALID_COMPILE_TIME_FUNCTION:
+    return "Invalid compile-time function";
+  case COMPILE_TIME_EVALUATION_FAILED:
+    return "Compile-time evaluation failed";
   case COMING_SOON_SA:
     return "Coming soon";
   }
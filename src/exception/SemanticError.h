@@ -86,6 +86,11 @@ enum SemanticErrorType : uint8_t {
   INVALID_SYSCALL_NUMBER_TYPE,
   SYSCALL_NUMBER_OUT_OF_RANGE,
   TOO_MANY_SYSCALL_ARGS,
+  INVALID_SIMD_VECTOR,
+  INVALID_SHUFFLE_INDEX,
+  ATOMIC_ARG_COUNT_ERROR,
+  INVALID_ATOMIC_TYPE,
+  INVALID_MEMORY_ORDER,
   RETURN_WITHOUT_VALUE_RESULT,
   RETURN_WITH_VALUE_IN_PROCEDURE,
   RETURN_OF_TEMPORARY_VALUE,
@@ -117,6 +122,8 @@ enum SemanticErrorType : uint8_t {
   DIVISION_BY_ZERO,
   TEST_FUNCTION_WITH_PARAMS,
   TEST_FUNCTION_WRONG_RETURN_TYPE,
+  INVALID_COMPILE_TIME_FUNCTION,
+  COMPILE_TIME_EVALUATION_FAILED,
   COMING_SOON_SA
 };
 
@@ -30,6 +30,7 @@ enum RuntimeModule : uint8_t {
 
 const std::unordered_map<const char *, RuntimeModule> TYPE_NAME_TO_RT_MODULE_MAPPING = {
     {STROBJ_NAME, STRING_RT},
+    {STRVIEWOBJ_NAME, STRING_RT},
     {RESULTOBJ_NAME, RESULT_RT},
     {ERROBJ_NAME, ERROR_RT},
 };
@@ -248,6 +248,11 @@ void DebugInfoGenerator::generateLocalVarDebugInfo(const std::string &varName, l
   llvm::DIExpression *expr = diBuilder->createExpression();
   const llvm::DILocation *debugLocation = irGenerator->builder.getCurrentDebugLocation();
   assert(debugLocation != nullptr);
+  llvm::BasicBlock *insertBlock = irGenerator->builder.GetInsertBlock();
+  if (insertBlock->empty()) { // e.g. the sret param, which is used as result variable without a local copy
+    diBuilder->insertDeclare(address, varInfo, expr, debugLocation, insertBlock);
+    return;
+  }
   llvm::Instruction *prevInst = irGenerator->builder.GetInsertPoint()->getPrevNonDebugInstruction();
   diBuilder->insertDeclare(address, varInfo, expr, debugLocation, prevInst);
 }
@@ -22,6 +22,12 @@ std::any IRGenerator::visitBuiltinCall(const BuiltinCallNode *node) {
     return visit(node->panicCall);
   if (node->sysCall)
     return visit(node->sysCall);
+  if (node->shuffleCall)
+    return visit(node->shuffleCall);
+  if (node->reduceCall)
+    return visit(node->reduceCall);
+  if (node->atomicCall)
+    return visit(node->atomicCall);
   assert_fail("Unknown builtin call");
   return nullptr;
 }
@@ -50,8 +56,7 @@ std::any IRGenerator::visitPrintfCall(const PrintfCallNode *node) {
     } else if (argSymbolType.getBase().isStringObj()) {
       llvm::Value *argValPtr = resolveAddress(arg);
       llvm::Type *argBaseType = argSymbolType.getBase().toLLVMType(sourceFile);
-      argValPtr = insertStructGEP(argBaseType, argValPtr, 0);
-      argVal = insertLoad(builder.getPtrTy(), argValPtr);
+      argVal = generateStringObjCharsAccess(argValPtr, argBaseType);
     } else {
       argVal = resolveValue(arg);
     }
@@ -190,4 +195,146 @@ std::any IRGenerator::visitSysCall(const SysCallNode *node) {
   return LLVMExprResult{.value = result};
 }
 
+std::any IRGenerator::visitShuffleCall(const ShuffleCallNode *node) {
+  // Load the array as vector
+  const QualType vectorSTy = node->vector->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  llvm::Value *vector = insertSimdLoad(vectorSTy, resolveAddress(node->vector));
+
+  // Rearrange the lanes. The indices were already validated by the type checker
+  llvm::Value *result = builder.CreateShuffleVector(vector, node->laneIndices);
+
+  const QualType resultSTy = node->getEvaluatedSymbolType(manIdx);
+  return LLVMExprResult{.value = materializeSimdVector(resultSTy, result)};
+}
+
+std::any IRGenerator::visitReduceCall(const ReduceCallNode *node) {
+  // Load the array as vector
+  const QualType vectorSTy = node->vector->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  llvm::Value *vector = insertSimdLoad(vectorSTy, resolveAddress(node->vector));
+  const QualType elementSTy = vectorSTy.getContained();
+  llvm::Type *elementType = elementSTy.toLLVMType(sourceFile);
+  const bool isFP = elementSTy.is(TY_DOUBLE);
+
+  // Reduce all lanes to a single value
+  llvm::Value *result;
+  switch (node->op) {
+  case ReduceCallNode::ReduceOp::OP_ADD:
+    result = isFP ? builder.CreateFAddReduce(llvm::ConstantFP::getNegativeZero(elementType), vector)
+                  : builder.CreateAddReduce(vector);
+    break;
+  case ReduceCallNode::ReduceOp::OP_MUL:
+    result = isFP ? builder.CreateFMulReduce(llvm::ConstantFP::get(elementType, 1.0), vector) : builder.CreateMulReduce(vector);
+    break;
+  case ReduceCallNode::ReduceOp::OP_BITWISE_AND:
+    result = builder.CreateAndReduce(vector);
+    break;
+  case ReduceCallNode::ReduceOp::OP_BITWISE_OR:
+    result = builder.CreateOrReduce(vector);
+    break;
+  case ReduceCallNode::ReduceOp::OP_BITWISE_XOR:
+    result = builder.CreateXorReduce(vector);
+    break;
+  case ReduceCallNode::ReduceOp::OP_MIN:
+    result = isFP ? builder.CreateFPMinReduce(vector) : builder.CreateIntMinReduce(vector, elementSTy.isSigned());
+    break;
+  case ReduceCallNode::ReduceOp::OP_MAX:
+    result = isFP ? builder.CreateFPMaxReduce(vector) : builder.CreateIntMaxReduce(vector, elementSTy.isSigned());
+    break;
+  default:                                                            // GCOV_EXCL_LINE
+    throw CompilerError(UNHANDLED_BRANCH, "Unknown reduce operator"); // GCOV_EXCL_LINE
+  }
+
+  return LLVMExprResult{.value = result};
+}
+
+std::any IRGenerator::visitAtomicCall(const AtomicCallNode *node) {
+  // Resolve the pointer and the value operands
+  const QualType ptrSTy = node->args.front()->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  const QualType valueSTy = ptrSTy.getContained().toNonConst();
+  llvm::Type *valueTy = valueSTy.toLLVMType(sourceFile);
+  llvm::Value *ptr = resolveValue(node->args.front());
+  std::vector<llvm::Value *> operands;
+  for (size_t i = 1; i < node->args.size() - 1; i++)
+    operands.push_back(resolveValue(node->args.at(i)));
+  llvm::Value *order = resolveValue(node->args.back());
+
+  const auto generateAtomicOp = [&](llvm::AtomicOrdering ordering) -> llvm::Value * {
+    switch (node->op) {
+    case AtomicCallNode::AtomicOp::OP_LOAD: {
+      // Loads cannot have release semantics
+      if (ordering == llvm::AtomicOrdering::Release)
+        ordering = llvm::AtomicOrdering::Monotonic;
+      else if (ordering == llvm::AtomicOrdering::AcquireRelease)
+        ordering = llvm::AtomicOrdering::Acquire;
+      llvm::LoadInst *loadInst = builder.CreateLoad(valueTy, ptr);
+      loadInst->setAtomic(ordering);
+      return loadInst;
+    }
+    case AtomicCallNode::AtomicOp::OP_STORE: {
+      // Stores cannot have acquire semantics
+      if (ordering == llvm::AtomicOrdering::Acquire)
+        ordering = llvm::AtomicOrdering::Monotonic;
+      else if (ordering == llvm::AtomicOrdering::AcquireRelease)
+        ordering = llvm::AtomicOrdering::Release;
+      llvm::StoreInst *storeInst = builder.CreateStore(operands.front(), ptr);
+      storeInst->setAtomic(ordering);
+      return nullptr;
+    }
+    case AtomicCallNode::AtomicOp::OP_EXCHANGE:
+      return builder.CreateAtomicRMW(llvm::AtomicRMWInst::Xchg, ptr, operands.front(), llvm::MaybeAlign(), ordering);
+    case AtomicCallNode::AtomicOp::OP_COMPARE_EXCHANGE: {
+      const llvm::AtomicOrdering failureOrdering = llvm::AtomicCmpXchgInst::getStrongestFailureOrdering(ordering);
+      llvm::Value *result =
+          builder.CreateAtomicCmpXchg(ptr, operands.at(0), operands.at(1), llvm::MaybeAlign(), ordering, failureOrdering);
+      return builder.CreateExtractValue(result, 1);
+    }
+    case AtomicCallNode::AtomicOp::OP_FETCH_ADD: {
+      const llvm::AtomicRMWInst::BinOp binOp = valueSTy.is(TY_DOUBLE) ? llvm::AtomicRMWInst::FAdd : llvm::AtomicRMWInst::Add;
+      return builder.CreateAtomicRMW(binOp, ptr, operands.front(), llvm::MaybeAlign(), ordering);
+    }
+    default:                                                             // GCOV_EXCL_LINE
+      throw CompilerError(UNHANDLED_BRANCH, "Unknown atomic operation"); // GCOV_EXCL_LINE
+    }
+  };
+
+  // If the memory order is known at compile time, emit the operation directly
+  static constexpr llvm::AtomicOrdering ORDERINGS[] = {llvm::AtomicOrdering::Monotonic, llvm::AtomicOrdering::Acquire,
+                                                       llvm::AtomicOrdering::Release, llvm::AtomicOrdering::AcquireRelease,
+                                                       llvm::AtomicOrdering::SequentiallyConsistent};
+  static constexpr uint64_t SEQ_CST_IDX = std::size(ORDERINGS) - 1;
+  if (const auto constOrder = llvm::dyn_cast<llvm::ConstantInt>(order)) {
+    const uint64_t orderIdx = std::min(constOrder->getZExtValue(), SEQ_CST_IDX);
+    return LLVMExprResult{.value = generateAtomicOp(ORDERINGS[orderIdx])};
+  }
+
+  // Otherwise, dispatch over all orderings at runtime. This folds away as soon as the order gets constant after inlining
+  const std::string codeLine = node->codeLoc.toPrettyLine();
+  llvm::BasicBlock *bSeqCst = createBlock("atomic.order." + std::to_string(SEQ_CST_IDX) + "." + codeLine);
+  llvm::BasicBlock *bExit = createBlock("atomic.exit." + codeLine);
+  llvm::SwitchInst *switchInst = builder.CreateSwitch(order, bSeqCst, SEQ_CST_IDX);
+  blockAlreadyTerminated = true;
+  std::vector<std::pair<llvm::Value *, llvm::BasicBlock *>> results;
+  for (uint64_t orderIdx = 0; orderIdx <= SEQ_CST_IDX; orderIdx++) {
+    llvm::BasicBlock *bOrder = bSeqCst;
+    if (orderIdx != SEQ_CST_IDX) {
+      bOrder = createBlock("atomic.order." + std::to_string(orderIdx) + "." + codeLine);
+      switchInst->addCase(llvm::cast<llvm::ConstantInt>(llvm::ConstantInt::get(order->getType(), orderIdx)), bOrder);
+    }
+    switchToBlock(bOrder);
+    llvm::Value *result = generateAtomicOp(ORDERINGS[orderIdx]);
+    results.emplace_back(result, builder.GetInsertBlock());
+    insertJump(bExit);
+  }
+  switchToBlock(bExit);
+
+  // Store does not produce a value
+  if (node->op == AtomicCallNode::AtomicOp::OP_STORE)
+    return LLVMExprResult{};
+
+  llvm::PHINode *phiInst = builder.CreatePHI(results.front().first->getType(), results.size(), "atomic.result");
+  for (const auto &[result, block] : results)
+    phiInst->addIncoming(result, block);
+  return LLVMExprResult{.value = phiInst};
+}
+
 } // namespace spice::compiler
\ No newline at end of file
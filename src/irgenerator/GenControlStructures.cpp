@@ -3,6 +3,7 @@
 #include "IRGenerator.h"
 
 #include <ast/ASTNodes.h>
+#include <global/GlobalResourceManager.h>
 #include <symboltablebuilder/ScopeHandle.h>
 
 namespace spice::compiler {
@@ -97,22 +98,42 @@ std::any IRGenerator::visitForeachLoop(const ForeachLoopNode *node) {
   if (node->getIteratorFct != nullptr) { // The iteratorAssignExpr is of type Iterable
     llvm::Value *iterablePtr = resolveAddress(iteratorAssignNode);
 
-    llvm::Value *iterator;
+    // Large iterators are constructed by the callee directly in the memory, which we pass as hidden sret param
+    const QualType &iteratorSTy = node->getIteratorFct->returnType;
+    const bool hasSRet = isSRetType(iteratorSTy);
+    llvm::Type *iteratorTy = iteratorSTy.toLLVMType(sourceFile);
+    llvm::Value *sretPtr = hasSRet ? insertAlloca(iteratorTy) : nullptr;
+
+    llvm::CallInst *iterator;
     if (!node->getIteratorFct->isMethod() && node->getIteratorFct->getParamTypes().front().isArray()) { // Array as iterable
       // Call iterate() function from std/iterator/array-iterator
-      llvm::Function *iterateFct = stdFunctionManager.getIterateFct(node->getIteratorFct);
+      llvm::Function *iterateFct = stdFunctionManager.getIterateFct(node->getIteratorFct, hasSRet);
       const size_t arraySize = iteratorAssignNode->getEvaluatedSymbolType(manIdx).getArraySize();
       assert(arraySize > 0);
-      iterator = builder.CreateCall(iterateFct, {iterablePtr, builder.getInt64(arraySize)});
+      if (hasSRet) {
+        iterator = builder.CreateCall(iterateFct, {sretPtr, iterablePtr, builder.getInt64(arraySize)});
+        iterator->addParamAttr(0, llvm::Attribute::getWithStructRetType(context, iteratorTy));
+      } else {
+        iterator = builder.CreateCall(iterateFct, {iterablePtr, builder.getInt64(arraySize)});
+      }
     } else { // Struct as iterable
       // Call .getIterator() on iterable
-      llvm::Function *getIteratorFct = stdFunctionManager.getIteratorFct(node->getIteratorFct);
-      iterator = builder.CreateCall(getIteratorFct, iterablePtr);
+      llvm::Function *getIteratorFct = stdFunctionManager.getIteratorFct(node->getIteratorFct, hasSRet);
+      if (hasSRet) {
+        iterator = builder.CreateCall(getIteratorFct, {iterablePtr, sretPtr});
+        iterator->addParamAttr(1, llvm::Attribute::getWithStructRetType(context, iteratorTy));
+      } else {
+        iterator = builder.CreateCall(getIteratorFct, iterablePtr);
+      }
     }
 
     // Resolve address of iterator
-    LLVMExprResult callResult = {.value = iterator, .node = iteratorAssignNode};
-    iteratorPtr = resolveAddress(callResult);
+    if (hasSRet) {
+      iteratorPtr = sretPtr;
+    } else {
+      LLVMExprResult callResult = {.value = iterator, .node = iteratorAssignNode};
+      iteratorPtr = resolveAddress(callResult);
+    }
 
     // Attach address to anonymous symbol to keep track of de-allocation
     SymbolTableEntry *returnSymbol = currentScope->symbolTable.lookupAnonymous(iteratorAssignNode->codeLoc);
@@ -169,6 +190,7 @@ std::any IRGenerator::visitForeachLoop(const ForeachLoopNode *node) {
     llvm::Value *pairPtr = insertAlloca(pairTy, "pair_addr");
     // Call .getIdx() on iterator
     assert(node->getIdxFct);
+    assert(!isSRetType(node->getIdxFct->returnType)); // Pairs of idx and item ref always fit into registers
     llvm::Function *getIdxFct = stdFunctionManager.getIteratorGetIdxFct(node->getIdxFct);
     llvm::Value *pair = builder.CreateCall(getIdxFct, iteratorPtr);
     pair->setName("pair");
@@ -382,11 +404,18 @@ std::any IRGenerator::visitSwitchStmt(const SwitchStmtNode *node) {
   // Save the blocks for break and continue
   breakBlocks.push_back(bExit);
 
-  // Visit switch expression
-  llvm::Value *exprValue = resolveValue(node->assignExpr);
+  // Generate dispatch to the case blocks
+  llvm::SwitchInst *switchInst = nullptr;
+  const QualType exprSTy = node->assignExpr->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  if (exprSTy.is(TY_STRING) || exprSTy.isStringObj()) {
+    generateStringSwitchDispatch(node, bCases, bDefault ? bDefault : bExit);
+  } else {
+    // Visit switch expression
+    llvm::Value *exprValue = resolveValue(node->assignExpr);
 
-  // Generate switch instruction
-  llvm::SwitchInst *switchInst = builder.CreateSwitch(exprValue, bDefault ? bDefault : bExit, node->caseBranches.size());
+    // Generate switch instruction
+    switchInst = builder.CreateSwitch(exprValue, bDefault ? bDefault : bExit, node->caseBranches.size());
+  }
 
   // Generate case branches
   for (size_t i = 0; i < node->caseBranches.size(); i++) {
@@ -411,9 +440,11 @@ std::any IRGenerator::visitSwitchStmt(const SwitchStmtNode *node) {
     fallthroughBlocks.pop();
 
     // Add case to switch instruction
-    for (const CaseConstantNode *caseConstantNode : caseBranch->caseConstants) {
-      const auto caseValue = std::any_cast<llvm::Constant *>(visit(caseConstantNode));
-      switchInst->addCase(llvm::cast<llvm::ConstantInt>(caseValue), bCases.at(i));
+    if (switchInst != nullptr) {
+      for (const CaseConstantNode *caseConstantNode : caseBranch->caseConstants) {
+        const auto caseValue = std::any_cast<llvm::Constant *>(visit(caseConstantNode));
+        switchInst->addCase(llvm::cast<llvm::ConstantInt>(caseValue), bCases.at(i));
+      }
     }
   }
 
@@ -439,6 +470,78 @@ std::any IRGenerator::visitSwitchStmt(const SwitchStmtNode *node) {
   return nullptr;
 }
 
+/**
+ * Generate the dispatch of a switch statement over a string or String object. The case constants are grouped by their
+ * length at compile time. At runtime, a switch over the length of the switch expression selects the group and within the
+ * group, the candidates are compared via memcmp with a constant length, which LLVM expands to a few loads and compares.
+ *
+ * @param node Switch statement node
+ * @param bCases Case blocks in the order of the case branches
+ * @param bDefault Block to jump to if no case matches
+ */
+void IRGenerator::generateStringSwitchDispatch(const SwitchStmtNode *node, const std::vector<llvm::BasicBlock *> &bCases,
+                                               llvm::BasicBlock *bDefault) {
+  // Retrieve pointer to the chars and length of the switch expression
+  const QualType exprSTy = node->assignExpr->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  llvm::Value *charsPtr;
+  llvm::Value *length;
+  if (exprSTy.isStringObj()) {
+    llvm::Value *stringObjPtr = resolveAddress(node->assignExpr);
+    llvm::Type *stringObjType = exprSTy.toLLVMType(sourceFile);
+    const auto [stringObjChars, stringObjLength] = generateStringObjDataAccess(stringObjPtr, stringObjType);
+    charsPtr = stringObjChars;
+    length = stringObjLength;
+  } else {
+    // Treat nil as empty string, like the string runtime does
+    llvm::Value *rawCharsPtr = resolveValue(node->assignExpr);
+    llvm::Constant *emptyString = createGlobalStringConst(ANON_GLOBAL_STRING_NAME, "", node->codeLoc);
+    charsPtr = builder.CreateSelect(builder.CreateIsNull(rawCharsPtr), emptyString, rawCharsPtr);
+    length = builder.CreateCall(stdFunctionManager.getStrlenFct(), charsPtr);
+  }
+
+  // Group case constants by their length. The first occurrence of a constant wins
+  std::map<size_t, std::vector<std::pair<const std::string *, llvm::BasicBlock *>>> casesByLength;
+  for (size_t i = 0; i < node->caseBranches.size(); i++) {
+    for (const CaseConstantNode *caseConstantNode : node->caseBranches.at(i)->caseConstants) {
+      assert(caseConstantNode->constant != nullptr);
+      const size_t stringValueOffset = caseConstantNode->constant->getCompileTimeValue().stringValueOffset;
+      const std::string &value = resourceManager.compileTimeStringValues.at(stringValueOffset);
+      casesByLength[value.length()].emplace_back(&value, bCases.at(i));
+    }
+  }
+
+  // Generate switch over the length
+  const std::string codeLine = node->codeLoc.toPrettyLine();
+  llvm::SwitchInst *lengthSwitchInst = builder.CreateSwitch(length, bDefault, casesByLength.size());
+  blockAlreadyTerminated = true;
+
+  // Compare the candidates of each length group
+  llvm::Function *memcmpFct = stdFunctionManager.getMemcmpFct();
+  for (const auto &[valueLength, candidates] : casesByLength) {
+    llvm::BasicBlock *bLength = createBlock("switch.length." + codeLine);
+    lengthSwitchInst->addCase(builder.getInt64(valueLength), bLength);
+    switchToBlock(bLength);
+
+    // An empty string matches by its length
+    if (valueLength == 0) {
+      insertJump(candidates.front().second);
+      continue;
+    }
+
+    for (size_t i = 0; i < candidates.size(); i++) {
+      const auto &[value, bCase] = candidates.at(i);
+      llvm::Constant *valueString = createGlobalStringConst("switch.str.", *value, node->codeLoc);
+      llvm::Value *cmpResult = builder.CreateCall(memcmpFct, {charsPtr, valueString, builder.getInt64(valueLength)});
+      llvm::Value *isEqual = builder.CreateICmpEQ(cmpResult, builder.getInt32(0));
+      const bool isLastCandidate = i + 1 == candidates.size();
+      llvm::BasicBlock *bNext = isLastCandidate ? bDefault : createBlock("switch.cmp." + codeLine);
+      insertCondJump(isEqual, bCase, bNext);
+      if (!isLastCandidate)
+        switchToBlock(bNext);
+    }
+  }
+}
+
 std::any IRGenerator::visitCaseBranch(const CaseBranchNode *node) {
   diGenerator.setSourceLocation(node);
 
@@ -4,6 +4,7 @@
 
 #include <ast/ASTNodes.h>
 
+#include <llvm/Analysis/ValueTracking.h>
 #include <llvm/IR/Module.h>
 
 namespace spice::compiler {
@@ -598,6 +599,10 @@ std::any IRGenerator::visitCastExpr(const CastExprNode *node) {
   const QualType rhsSTy = rhsNode->getEvaluatedSymbolType(manIdx);
   auto rhs = std::any_cast<LLVMExprResult>(visit(rhsNode));
 
+  // Accesses through the casted pointer may reinterpret the pointee. Exclude it from type-based alias analysis
+  if (tbaaTags.charTag && targetSTy.isPtr() && rhsSTy.removeReferenceWrapper().isPtr())
+    punnedObjects.insert(llvm::getUnderlyingObject(resolveValue(rhsSTy, rhs)));
+
   // Retrieve the result value
   const LLVMExprResult result = conversionManager.getCastInst(node, targetSTy, rhs, rhsSTy);
 
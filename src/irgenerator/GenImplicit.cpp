@@ -67,37 +67,31 @@ void IRGenerator::generateScopeCleanup(const StmtLstNode *node) const {
     generateDeallocCall(entry->getAddress());
 
   // Generate lifetime end markers
-  if (cliOptions.useLifetimeMarkers) {
-    for (const SymbolTableEntry *var : currentScope->getVarsGoingOutOfScope()) {
-      llvm::Value *address = var->getAddress();
-      if (address == nullptr)
-        continue;
-      const uint64_t sizeInBytes = module->getDataLayout().getTypeAllocSize(var->getQualType().toLLVMType(sourceFile));
-      builder.CreateLifetimeEnd(address, builder.getInt64(sizeInBytes));
-    }
-  }
+  generateLifetimeEndMarkers(node);
 }
 
-llvm::Value *IRGenerator::generateFctCall(const Function *fct, const std::vector<llvm::Value *> &args) const {
-  // Retrieve metadata for the function
-  const std::string mangledName = fct->getMangledName();
+/**
+ * End the lifetimes of all stack-allocated variables of the current scope, that were declared directly within the given
+ * statement list. Variables, declared in the head of a control structure (e.g. the loop variable of a for loop), are not
+ * affected, because they outlive the body. Their lifetimes are ended when the scope handle leaves the scope.
+ *
+ * @param declStmtLst Statement list, which the variables have to be declared in
+ */
+void IRGenerator::generateLifetimeEndMarkers(const StmtLstNode *declStmtLst) const {
+  if (!cliOptions.useLifetimeMarkers || blockAlreadyTerminated)
+    return;
 
-  // Function is not defined in the current module -> declare it
-  if (!module->getFunction(mangledName)) {
-    std::vector<llvm::Type *> paramTypes;
-    for (const llvm::Value *argValue : args)
-      paramTypes.push_back(argValue->getType());
-    llvm::Type *returnType = fct->returnType.toLLVMType(sourceFile);
-    llvm::FunctionType *fctType = llvm::FunctionType::get(returnType, paramTypes, false);
-    module->getOrInsertFunction(mangledName, fctType);
+  for (const SymbolTableEntry *var : currentScope->getVarsGoingOutOfScope()) {
+    // Only variables with own stack memory have a lifetime
+    const auto allocaInst = llvm::dyn_cast_or_null<llvm::AllocaInst>(var->getAddress());
+    if (allocaInst == nullptr || var->declNode == nullptr)
+      continue;
+    // Skip variables, that were declared outside the statement list
+    if (var->declNode->getNextOuterStmtLst() != declStmtLst)
+      continue;
+    const uint64_t sizeInBytes = module->getDataLayout().getTypeAllocSize(allocaInst->getAllocatedType());
+    builder.CreateLifetimeEnd(allocaInst, builder.getInt64(sizeInBytes));
   }
-
-  // Get callee function
-  llvm::Function *callee = module->getFunction(mangledName);
-  assert(callee != nullptr);
-
-  // Generate function call
-  return builder.CreateCall(callee, args);
 }
 
 void IRGenerator::generateProcCall(const Function *proc, std::vector<llvm::Value *> &args) const {
@@ -170,6 +164,53 @@ void IRGenerator::generateDeallocCall(llvm::Value *variableAddress) const {
   }
 }
 
+/**
+ * Retrieve the chars and the length of a String object. Short strings store their chars inline and the length in the last
+ * byte, long strings point to the heap and mark this with the highest bit of the length field.
+ * See std/runtime/string_rt.spice for the full layout.
+ *
+ * @param stringObjPtr Pointer to the String object
+ * @param stringObjType LLVM type of the String object
+ * @return Pointer to the first char and length
+ */
+std::pair<llvm::Value *, llvm::Value *> IRGenerator::generateStringObjDataAccess(llvm::Value *stringObjPtr,
+                                                                                 llvm::Type *stringObjType) const {
+  llvm::Value *lengthField = generateStringObjLengthFieldLoad(stringObjPtr, stringObjType);
+  llvm::Value *isLongMode = builder.CreateICmpSLT(lengthField, builder.getInt64(0), "str.long");
+  llvm::Value *chars = generateStringObjCharsSelect(stringObjPtr, stringObjType, isLongMode);
+
+  // Long mode: length in the lower 63 bits. Short mode: length in the last byte
+  llvm::Value *longLength = builder.CreateAnd(lengthField, builder.getInt64(STROBJ_LONG_LENGTH_MASK));
+  llvm::Value *shortLength = builder.CreateLShr(lengthField, builder.getInt64(STROBJ_INLINE_LENGTH_SHIFT));
+  llvm::Value *length = builder.CreateSelect(isLongMode, longLength, shortLength, "str.length");
+  return {chars, length};
+}
+
+/**
+ * Retrieve only the chars of a String object, without decoding its length
+ *
+ * @param stringObjPtr Pointer to the String object
+ * @param stringObjType LLVM type of the String object
+ * @return Pointer to the first char
+ */
+llvm::Value *IRGenerator::generateStringObjCharsAccess(llvm::Value *stringObjPtr, llvm::Type *stringObjType) const {
+  llvm::Value *lengthField = generateStringObjLengthFieldLoad(stringObjPtr, stringObjType);
+  llvm::Value *isLongMode = builder.CreateICmpSLT(lengthField, builder.getInt64(0), "str.long");
+  return generateStringObjCharsSelect(stringObjPtr, stringObjType, isLongMode);
+}
+
+llvm::Value *IRGenerator::generateStringObjLengthFieldLoad(llvm::Value *stringObjPtr, llvm::Type *stringObjType) const {
+  llvm::Value *lengthFieldPtr = insertStructGEP(stringObjType, stringObjPtr, 2);
+  return insertLoad(builder.getInt64Ty(), lengthFieldPtr, false, "str.length.field");
+}
+
+llvm::Value *IRGenerator::generateStringObjCharsSelect(llvm::Value *stringObjPtr, llvm::Type *stringObjType,
+                                                       llvm::Value *isLongMode) const {
+  // Long mode: heap chars. Short mode: inline chars
+  llvm::Value *heapChars = insertLoad(builder.getPtrTy(), insertStructGEP(stringObjType, stringObjPtr, 0), false, "str.heap");
+  return builder.CreateSelect(isLongMode, heapChars, stringObjPtr, "str.chars");
+}
+
 llvm::Function *IRGenerator::generateImplicitFunction(const std::function<void()> &generateBody, const Function *spiceFunc) {
   // Only focus on method procedures
   const ASTNode *node = spiceFunc->entry->declNode;
@@ -180,6 +221,7 @@ llvm::Function *IRGenerator::generateImplicitFunction(const std::function<void()
     return nullptr;
 
   // Retrieve return type
+  assert(!isSRetType(spiceFunc->returnType)); // Implicit functions never return large structs
   llvm::Type *returnType = spiceFunc->returnType.toLLVMType(sourceFile);
 
   // Get 'this' entry
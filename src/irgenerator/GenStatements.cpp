@@ -111,8 +111,27 @@ std::any IRGenerator::visitCaseConstant(const CaseConstantNode *node) {
 std::any IRGenerator::visitReturnStmt(const ReturnStmtNode *node) {
   diGenerator.setSourceLocation(node);
 
+  // Large structs are constructed directly in the memory of the caller, so there is nothing to return by value
+  const bool hasSRet = builder.GetInsertBlock()->getParent()->hasStructRetAttr();
+
   llvm::Value *returnValue = nullptr;
-  if (node->hasReturnValue) { // Return value is attached to the return statement
+  if (hasSRet) {
+    const SymbolTableEntry *resultEntry = currentScope->lookup(RETURN_VARIABLE_NAME);
+    assert(resultEntry != nullptr);
+    llvm::Value *resultAddress = resultEntry->getAddress();
+    if (node->hasReturnValue) {
+      const AssignExprNode *returnExpr = node->assignExpr;
+      llvm::Value *originalAddress = resolveAddress(returnExpr);
+      if (node->calledCopyCtor) {
+        // Perform the copy directly into the result memory
+        generateCtorOrDtorCall(resultAddress, node->calledCopyCtor, {originalAddress});
+      } else if (originalAddress != resultAddress) {
+        // Move the returned value into the result memory
+        llvm::Type *returnTy = node->returnType.toLLVMType(sourceFile);
+        generateShallowCopy(originalAddress, returnTy, resultAddress, false);
+      }
+    }
+  } else if (node->hasReturnValue) { // Return value is attached to the return statement
     const AssignExprNode* returnExpr = node->assignExpr;
     if (node->calledCopyCtor) {
       // Perform a copy
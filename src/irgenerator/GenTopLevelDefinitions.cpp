@@ -191,6 +191,14 @@ std::any IRGenerator::visitFctDef(const FctDefNode *node) {
     // Get return type
     llvm::Type *returnType = manifestation->returnType.toLLVMType(sourceFile);
 
+    // Large structs are constructed directly in the memory of the caller, which is passed as hidden sret param
+    const bool hasSRet = isSRetType(manifestation->returnType);
+    const unsigned int sretArgNo = manifestation->isMethod() ? 1 : 0;
+    if (hasSRet) {
+      paramInfoList.insert(paramInfoList.begin() + sretArgNo, {RETURN_VARIABLE_NAME, nullptr});
+      paramTypes.insert(paramTypes.begin() + sretArgNo, builder.getPtrTy());
+    }
+
     // Check if function is explicitly inlined
     const bool explicitlyInlined = manifestation->entry->getQualType().isInline();
     // Get function linkage
@@ -201,7 +209,7 @@ std::any IRGenerator::visitFctDef(const FctDefNode *node) {
 
     // Create function or implement declared function
     const std::string mangledName = manifestation->getMangledName();
-    llvm::FunctionType *funcType = llvm::FunctionType::get(returnType, paramTypes, false);
+    llvm::FunctionType *funcType = llvm::FunctionType::get(hasSRet ? builder.getVoidTy() : returnType, paramTypes, false);
     module->getOrInsertFunction(mangledName, funcType);
     llvm::Function *func = module->getFunction(mangledName);
     node->entry->updateAddress(func);
@@ -225,6 +233,14 @@ std::any IRGenerator::visitFctDef(const FctDefNode *node) {
       func->addParamAttr(0, llvm::Attribute::getWithAlignment(context, module->getDataLayout().getABITypeAlign(structType)));
     }
 
+    // Set attributes to sret param
+    if (hasSRet)
+      addSRetParamAttrs(func, sretArgNo, returnType);
+
+    // Set attributes to reference params
+    if (cliOptions.optLevel > OptLevel::O0)
+      addRefParamAttrs(func, manifestation->getParamTypes(), (manifestation->isMethod() ? 1 : 0) + (hasSRet ? 1 : 0));
+
     // Add debug info
     diGenerator.generateFunctionDebugInfo(func, manifestation);
     diGenerator.setSourceLocation(node);
@@ -238,7 +254,13 @@ std::any IRGenerator::visitFctDef(const FctDefNode *node) {
     allocaInsertInst = nullptr;
 
     // Declare result variable
-    llvm::Value *resultAddr = insertAlloca(returnType, RETURN_VARIABLE_NAME);
+    llvm::Value *resultAddr;
+    if (hasSRet) {
+      resultAddr = func->getArg(sretArgNo);
+      resultAddr->setName(RETURN_VARIABLE_NAME);
+    } else {
+      resultAddr = insertAlloca(returnType, RETURN_VARIABLE_NAME);
+    }
     SymbolTableEntry *resultEntry = currentScope->lookupStrict(RETURN_VARIABLE_NAME);
     assert(resultEntry != nullptr);
     resultEntry->updateAddress(resultAddr);
@@ -247,6 +269,9 @@ std::any IRGenerator::visitFctDef(const FctDefNode *node) {
 
     // Store function argument values
     for (auto &arg : func->args()) {
+      // The sret param is the result variable itself
+      if (arg.hasStructRetAttr())
+        continue;
       // Get information about the parameter
       const size_t argNumber = arg.getArgNo();
       auto [paramName, paramSymbol] = paramInfoList.at(argNumber);
@@ -260,8 +285,9 @@ std::any IRGenerator::visitFctDef(const FctDefNode *node) {
       diGenerator.setSourceLocation(paramSymbol->declNode);
       // Store the value at the new address
       insertStore(&arg, paramAddress);
-      // Generate debug info to declare variable
-      diGenerator.generateLocalVarDebugInfo(paramName, paramAddress, argNumber + 1);
+      // Generate debug info to declare variable (the sret param is not visible in the source code)
+      const size_t diArgNumber = hasSRet && argNumber > sretArgNo ? argNumber : argNumber + 1;
+      diGenerator.generateLocalVarDebugInfo(paramName, paramAddress, diArgNumber);
     }
 
     // Store the default values for optional function args
@@ -276,8 +302,12 @@ std::any IRGenerator::visitFctDef(const FctDefNode *node) {
 
     // Create return statement if the block is not terminated yet
     if (!blockAlreadyTerminated) {
-      llvm::Value *result = insertLoad(returnType, resultEntry->getAddress());
-      builder.CreateRet(result);
+      if (hasSRet) {
+        builder.CreateRetVoid();
+      } else {
+        llvm::Value *result = insertLoad(returnType, resultEntry->getAddress());
+        builder.CreateRet(result);
+      }
     }
 
     // Conclude debug info for function
@@ -393,6 +423,10 @@ std::any IRGenerator::visitProcDef(const ProcDefNode *node) {
       proc->addParamAttr(0, llvm::Attribute::getWithAlignment(context, module->getDataLayout().getABITypeAlign(structType)));
     }
 
+    // Set attributes to reference params
+    if (cliOptions.optLevel > OptLevel::O0)
+      addRefParamAttrs(proc, manifestation->getParamTypes(), manifestation->isMethod() ? 1 : 0);
+
     // Add debug info
     diGenerator.generateFunctionDebugInfo(proc, manifestation);
     diGenerator.setSourceLocation(node);
@@ -573,9 +607,12 @@ std::any IRGenerator::visitGlobalVarDef(const GlobalVarDefNode *node) {
   var->setConstant(isConst);
 
   // Set initializer
-  if (node->hasValue) { // Set the constant value as variable initializer
+  if (node->constant) { // Set the constant value as variable initializer
     const auto constantValue = std::any_cast<llvm::Constant *>(visit(node->constant));
     var->setInitializer(constantValue);
+  } else if (node->fctCall) { // Set the value, computed at compile time, as variable initializer
+    llvm::Constant *constantValue = getConst(node->getCompileTimeValue(), entryType, node);
+    var->setInitializer(constantValue);
   } else if (cliOptions.buildMode == DEBUG) { // Set the default value as variable initializer
     llvm::Constant *constantValue = getDefaultValueForSymbolType(node->entry->getQualType());
     var->setInitializer(constantValue);
@@ -6,6 +6,7 @@
 
 #include <SourceFile.h>
 #include <irgenerator/NameMangling.h>
+#include <typechecker/StructManager.h>
 
 namespace spice::compiler {
 
@@ -144,4 +145,85 @@ void IRGenerator::generateVTableInitializer(const StructBase *spiceStruct) const
   global->setInitializer(initializer);
 }
 
+/**
+ * Try to resolve the target of a virtual method call at compile time by using the type hierarchy of the whole program.
+ * This succeeds if exactly one struct implements the interface and the implementation of the method is callable from the
+ * current module with the same signature. The implementation is picked from the same VTable slot, the dynamic dispatch
+ * would load it from.
+ *
+ * @param interfaceType Interface type of the call target
+ * @param virtualMethod Called interface method
+ * @param fctType LLVM function type of the call
+ * @return Implementing struct and LLVM function of the implementation or a pair of nullptrs
+ */
+std::pair<const Struct *, llvm::Function *> IRGenerator::getDevirtualizationTarget(const QualType &interfaceType,
+                                                                                 const Function *virtualMethod,
+                                                                                 llvm::FunctionType *fctType) const {
+  // Devirtualization is an optimization and therefore disabled for unoptimized builds
+  if (cliOptions.optLevel == OptLevel::O0)
+    return {nullptr, nullptr};
+
+  // Search for all implementors of the interface
+  const Interface *spiceInterface = interfaceType.getInterface(nullptr);
+  assert(spiceInterface != nullptr);
+  const std::vector<const Struct *> implementors = StructManager::getImplementors(spiceInterface, resourceManager);
+  if (implementors.size() != 1)
+    return {nullptr, nullptr};
+  const Struct *implementor = implementors.front();
+
+  // Retrieve the method from the VTable slot of the implementor
+  assert(implementor->scope != nullptr);
+  const std::vector<Function *> virtualMethods = implementor->scope->getVirtualMethods();
+  if (virtualMethod->vtableIndex >= virtualMethods.size())
+    return {nullptr, nullptr};
+  const Function *target = virtualMethods.at(virtualMethod->vtableIndex);
+
+  // Private methods of other source files cannot be referenced from this module
+  const bool isPublic = target->entry->getQualType().isPublic();
+  if (!isPublic && target->getDeclCodeLoc().sourceFile != sourceFile)
+    return {nullptr, nullptr};
+
+  // The implementation must be callable with the signature of the interface method
+  const std::string mangledName = target->getMangledName();
+  if (llvm::Function *fct = module->getFunction(mangledName)) {
+    if (fct->getFunctionType() != fctType)
+      return {nullptr, nullptr};
+    return {implementor, fct};
+  }
+  const bool hasSRet = isSRetType(target->returnType);
+  llvm::Type *returnType = builder.getVoidTy();
+  if (!target->returnType.is(TY_DYN) && !hasSRet)
+    returnType = target->returnType.toLLVMType(sourceFile);
+  std::vector<llvm::Type *> paramTypes = {builder.getPtrTy()}; // This pointer
+  if (hasSRet)
+    paramTypes.push_back(builder.getPtrTy()); // Sret pointer
+  for (const QualType &paramType : target->getParamTypes())
+    paramTypes.push_back(paramType.toLLVMType(sourceFile));
+  if (llvm::FunctionType::get(returnType, paramTypes, false) != fctType)
+    return {nullptr, nullptr};
+
+  // Declare the implementation in the current module
+  module->getOrInsertFunction(mangledName, fctType);
+  return {implementor, module->getFunction(mangledName)};
+}
+
+/**
+ * Get the address of the first virtual method slot in the VTable of the given struct. This is the pointer, that gets stored
+ * to the VTable field of every instance of the struct.
+ *
+ * @param spiceStruct Struct to get the VTable address point for
+ * @return VTable address point
+ */
+llvm::Constant *IRGenerator::getVTableAddressPoint(const StructBase *spiceStruct) const {
+  // Build the VTable type in the context of the current module
+  const size_t arrayElementCount = spiceStruct->scope->getVirtualMethods().size() + 2; // +2 for nullptr and TypeInfo
+  llvm::ArrayType *vtableArrayTy = llvm::ArrayType::get(builder.getPtrTy(), arrayElementCount);
+  llvm::StructType *vtableType = llvm::StructType::get(context, vtableArrayTy, false);
+
+  // Reference the VTable global, which might be defined by another module
+  llvm::Constant *vtable = module->getOrInsertGlobal(NameMangling::mangleVTable(spiceStruct), vtableType);
+  llvm::Constant *indices[3] = {builder.getInt64(0), builder.getInt32(0), builder.getInt32(2)};
+  return llvm::ConstantExpr::getInBoundsGetElementPtr(vtableType, vtable, indices);
+}
+
 } // namespace spice::compiler
\ No newline at end of file
@@ -134,12 +134,34 @@ std::any IRGenerator::visitFctCall(const FctCallNode *node) {
     }
   }
 
+  // Retrieve return and param types
+  QualType returnSType(TY_DYN);
+  QualTypeList paramSTypes;
+  if (data.isFctPtrCall()) {
+    if (firstFragEntry->getQualType().isBase(TY_FUNCTION))
+      returnSType = firstFragEntry->getQualType().getBase().getFunctionReturnType();
+    paramSTypes = firstFragEntry->getQualType().getBase().getFunctionParamTypes();
+  } else {
+    returnSType = spiceFunc->returnType;
+    paramSTypes = spiceFunc->getParamTypes();
+  }
+
+  // Large structs are constructed by the callee directly in the result memory, which we pass as hidden sret param
+  const bool isExtCall = !data.isFctPtrCall() && dynamic_cast<const ExtDeclNode *>(spiceFunc->declNode) != nullptr;
+  const bool hasSRet = !isExtCall && isSRetType(returnSType);
+  const unsigned int sretArgNo = argValues.size();
+  llvm::Type *sretType = nullptr;
+  llvm::Value *sretPtr = nullptr;
+  if (hasSRet) {
+    sretType = returnSType.toLLVMType(sourceFile);
+    sretPtr = insertAlloca(sretType);
+    argValues.push_back(sretPtr);
+  }
+
   // Get arg values
   if (node->hasArgs) {
     argValues.reserve(node->argLst->args.size());
     const std::vector<AssignExprNode *> args = node->argLst->args;
-    const QualTypeList paramSTypes =
-        data.isFctPtrCall() ? firstFragEntry->getQualType().getBase().getFunctionParamTypes() : spiceFunc->getParamTypes();
     assert(paramSTypes.size() == args.size());
     for (size_t i = 0; i < args.size(); i++) {
       AssignExprNode *argNode = args.at(i);
@@ -189,18 +211,6 @@ std::any IRGenerator::visitFctCall(const FctCallNode *node) {
     }
   }
 
-  // Retrieve return and param types
-  QualType returnSType(TY_DYN);
-  QualTypeList paramSTypes;
-  if (data.isFctPtrCall()) {
-    if (firstFragEntry->getQualType().isBase(TY_FUNCTION))
-      returnSType = firstFragEntry->getQualType().getBase().getFunctionReturnType();
-    paramSTypes = firstFragEntry->getQualType().getBase().getFunctionParamTypes();
-  } else {
-    returnSType = spiceFunc->returnType;
-    paramSTypes = spiceFunc->getParamTypes();
-  }
-
   // Function is not defined in the current module -> declare it
   llvm::FunctionType *fctType;
   if (llvm::Function *fct = module->getFunction(mangledName)) {
@@ -208,7 +218,7 @@ std::any IRGenerator::visitFctCall(const FctCallNode *node) {
   } else {
     // Get returnType
     llvm::Type *returnType = builder.getVoidTy();
-    if (!returnSType.is(TY_DYN))
+    if (!returnSType.is(TY_DYN) && !hasSRet)
       returnType = returnSType.toLLVMType(sourceFile);
 
     // Get arg types
@@ -217,6 +227,8 @@ std::any IRGenerator::visitFctCall(const FctCallNode *node) {
       argTypes.push_back(builder.getPtrTy()); // This pointer
     if (data.isFctPtrCall() && firstFragEntry->getQualType().hasLambdaCaptures())
       argTypes.push_back(builder.getPtrTy()); // Capture pointer
+    if (hasSRet)
+      argTypes.push_back(builder.getPtrTy()); // Sret pointer
     for (const QualType &paramType : paramSTypes)
       argTypes.push_back(paramType.toLLVMType(sourceFile));
 
@@ -226,19 +238,80 @@ std::any IRGenerator::visitFctCall(const FctCallNode *node) {
   }
   assert(fctType != nullptr);
 
-  llvm::CallInst *result;
+  // Attach attributes for the sret pointer and for the this pointer to method calls
+  const auto addCallParamAttrs = [&](llvm::CallInst *call) {
+    if (hasSRet)
+      call->addParamAttr(sretArgNo, llvm::Attribute::getWithStructRetType(context, sretType));
+    if (!data.isMethodCall() && !data.isCtorCall() && !data.isVirtualMethodCall())
+      return;
+    llvm::Type *thisType = data.thisType.toLLVMType(sourceFile);
+    call->addParamAttr(0, llvm::Attribute::NoUndef);
+    call->addParamAttr(0, llvm::Attribute::NonNull);
+    call->addDereferenceableParamAttr(0, module->getDataLayout().getTypeStoreSize(thisType));
+    call->addParamAttr(0, llvm::Attribute::getWithAlignment(context, module->getDataLayout().getABITypeAlign(thisType)));
+  };
+
+  llvm::Value *result;
   if (data.isVirtualMethodCall()) {
     assert(data.callee->isVirtual);
     assert(thisPtr != nullptr);
-    // Load VTable
-    llvm::Value *vtablePtr = insertLoad(builder.getPtrTy(), thisPtr, false, "vtable.addr");
-    const size_t vtableIndex = data.callee->vtableIndex;
-    // Lookup function pointer in VTable
-    fctPtr = insertInBoundsGEP(builder.getPtrTy(), vtablePtr, builder.getInt64(vtableIndex), "vfct.addr");
-    llvm::Value *fct = insertLoad(builder.getPtrTy(), fctPtr, false, "fct");
+    // Check if the call target can be resolved at compile time
+    const auto [implementor, directCallee] = getDevirtualizationTarget(data.thisType.getBase(), data.callee, fctType);
+    if (directCallee != nullptr && cliOptions.useLTO) {
+      // The whole program is known, so the only implementor is the only possible call target
+      llvm::CallInst *call = builder.CreateCall(directCallee, argValues);
+      addCallParamAttrs(call);
+      result = call;
+    } else {
+      // Load VTable
+      llvm::Value *vtablePtr = insertLoad(builder.getPtrTy(), thisPtr, false, "vtable.addr");
+
+      // Speculate on the only known implementor and fall back to the dynamic dispatch if the VTable does not match
+      llvm::BasicBlock *bExit = nullptr;
+      llvm::CallInst *directCall = nullptr;
+      llvm::BasicBlock *bDirectCallEnd = nullptr;
+      if (directCallee != nullptr) {
+        const std::string codeLine = node->codeLoc.toPrettyLine();
+        llvm::BasicBlock *bDirectCall = createBlock("devirt.direct." + codeLine);
+        llvm::BasicBlock *bVirtualCall = createBlock("devirt.virtual." + codeLine);
+        bExit = createBlock("devirt.exit." + codeLine);
+        llvm::Value *expectedVTable = getVTableAddressPoint(implementor);
+        llvm::Value *isExpectedVTable = builder.CreateICmpEQ(vtablePtr, expectedVTable, "vtable.cmp");
+        insertCondJump(isExpectedVTable, bDirectCall, bVirtualCall, LIKELY);
+
+        // Generate direct call
+        switchToBlock(bDirectCall);
+        directCall = builder.CreateCall(directCallee, argValues);
+        addCallParamAttrs(directCall);
+        bDirectCallEnd = builder.GetInsertBlock();
+        insertJump(bExit);
+
+        switchToBlock(bVirtualCall);
+      }
 
-    // Generate function call
-    result = builder.CreateCall({fctType, fct}, argValues);
+      const size_t vtableIndex = data.callee->vtableIndex;
+      // Lookup function pointer in VTable
+      fctPtr = insertInBoundsGEP(builder.getPtrTy(), vtablePtr, builder.getInt64(vtableIndex), "vfct.addr");
+      llvm::Value *fct = insertLoad(builder.getPtrTy(), fctPtr, false, "fct");
+
+      // Generate function call
+      llvm::CallInst *virtualCall = builder.CreateCall({fctType, fct}, argValues);
+      addCallParamAttrs(virtualCall);
+      result = virtualCall;
+
+      // Merge the results of the direct and the virtual call
+      if (directCall != nullptr) {
+        llvm::BasicBlock *bVirtualCallEnd = builder.GetInsertBlock();
+        insertJump(bExit);
+        switchToBlock(bExit);
+        if (!fctType->getReturnType()->isVoidTy()) {
+          llvm::PHINode *phi = builder.CreatePHI(fctType->getReturnType(), 2, "devirt.result");
+          phi->addIncoming(directCall, bDirectCallEnd);
+          phi->addIncoming(virtualCall, bVirtualCallEnd);
+          result = phi;
+        }
+      }
+    }
   } else if (data.isFctPtrCall()) {
     assert(firstFragEntry != nullptr);
     QualType firstFragType = firstFragEntry->getQualType();
@@ -248,22 +321,18 @@ std::any IRGenerator::visitFctCall(const FctCallNode *node) {
     llvm::Value *fct = insertLoad(builder.getPtrTy(), fctPtr, false, "fct");
 
     // Generate function call
-    result = builder.CreateCall({fctType, fct}, argValues);
+    llvm::CallInst *call = builder.CreateCall({fctType, fct}, argValues);
+    addCallParamAttrs(call);
+    result = call;
   } else {
     // Get callee function
     llvm::Function *callee = module->getFunction(mangledName);
     assert(callee != nullptr);
 
     // Generate function call
-    result = builder.CreateCall(callee, argValues);
-  }
-
-  if (data.isMethodCall() || data.isCtorCall() || data.isVirtualMethodCall()) {
-    llvm::Type *thisType = data.thisType.toLLVMType(sourceFile);
-    result->addParamAttr(0, llvm::Attribute::NoUndef);
-    result->addParamAttr(0, llvm::Attribute::NonNull);
-    result->addDereferenceableParamAttr(0, module->getDataLayout().getTypeStoreSize(thisType));
-    result->addParamAttr(0, llvm::Attribute::getWithAlignment(context, module->getDataLayout().getABITypeAlign(thisType)));
+    llvm::CallInst *call = builder.CreateCall(callee, argValues);
+    addCallParamAttrs(call);
+    result = call;
   }
 
   // Attach address to anonymous symbol to keep track of de-allocation
@@ -274,6 +343,8 @@ std::any IRGenerator::visitFctCall(const FctCallNode *node) {
     if (anonymousSymbol != nullptr) {
       if (data.isCtorCall()) {
         anonymousSymbol->updateAddress(thisPtr);
+      } else if (hasSRet) {
+        anonymousSymbol->updateAddress(sretPtr);
       } else {
         resultPtr = insertAlloca(result->getType());
         insertStore(result, resultPtr);
@@ -290,6 +361,10 @@ std::any IRGenerator::visitFctCall(const FctCallNode *node) {
   if (returnSType.isRef())
     return LLVMExprResult{.ptr = result, .refPtr = resultPtr, .entry = anonymousSymbol};
 
+  // In case the result was constructed in the sret memory, return the address
+  if (hasSRet)
+    return LLVMExprResult{.ptr = sretPtr, .entry = anonymousSymbol};
+
   // Otherwise return the value
   return LLVMExprResult{.value = result, .ptr = resultPtr, .entry = anonymousSymbol};
 }
@@ -477,10 +552,18 @@ std::any IRGenerator::visitLambdaFunc(const LambdaFuncNode *node) {
   // Get return type
   llvm::Type *returnType = spiceFunc.returnType.toLLVMType(sourceFile);
 
+  // Large structs are constructed directly in the memory of the caller, which is passed as hidden sret param
+  const bool hasSRet = isSRetType(spiceFunc.returnType);
+  const unsigned int sretArgNo = hasCaptures ? 1 : 0;
+  if (hasSRet) {
+    paramInfoList.insert(paramInfoList.begin() + sretArgNo, {RETURN_VARIABLE_NAME, nullptr});
+    paramTypes.insert(paramTypes.begin() + sretArgNo, builder.getPtrTy());
+  }
+
   // Create function or implement declared function
   spiceFunc.mangleSuffix = "." + std::to_string(manIdx);
   const std::string mangledName = spiceFunc.getMangledName();
-  llvm::FunctionType *funcType = llvm::FunctionType::get(returnType, paramTypes, false);
+  llvm::FunctionType *funcType = llvm::FunctionType::get(hasSRet ? builder.getVoidTy() : returnType, paramTypes, false);
   module->getOrInsertFunction(mangledName, funcType);
   llvm::Function *lambda = module->getFunction(mangledName);
 
@@ -495,6 +578,10 @@ std::any IRGenerator::visitLambdaFunc(const LambdaFuncNode *node) {
     lambda->addDereferenceableParamAttr(0, module->getDataLayout().getPointerSize());
   }
 
+  // Set attributes to sret param
+  if (hasSRet)
+    addSRetParamAttrs(lambda, sretArgNo, returnType);
+
   // Add debug info
   diGenerator.generateFunctionDebugInfo(lambda, &spiceFunc, true);
   diGenerator.setSourceLocation(node);
@@ -515,7 +602,13 @@ std::any IRGenerator::visitLambdaFunc(const LambdaFuncNode *node) {
   // Declare result variable
   SymbolTableEntry *resultEntry = currentScope->lookupStrict(RETURN_VARIABLE_NAME);
   assert(resultEntry != nullptr);
-  llvm::Value *resultAddr = insertAlloca(returnType, RETURN_VARIABLE_NAME);
+  llvm::Value *resultAddr;
+  if (hasSRet) {
+    resultAddr = lambda->getArg(sretArgNo);
+    resultAddr->setName(RETURN_VARIABLE_NAME);
+  } else {
+    resultAddr = insertAlloca(returnType, RETURN_VARIABLE_NAME);
+  }
   resultEntry->updateAddress(resultAddr);
   // Generate debug info
   diGenerator.generateLocalVarDebugInfo(RETURN_VARIABLE_NAME, resultAddr);
@@ -523,6 +616,9 @@ std::any IRGenerator::visitLambdaFunc(const LambdaFuncNode *node) {
   // Store function argument values
   llvm::Value *captureStructPtrPtr = nullptr;
   for (auto &arg : lambda->args()) {
+    // The sret param is the result variable itself
+    if (arg.hasStructRetAttr())
+      continue;
     // Get parameter info
     const size_t argNumber = arg.getArgNo();
     auto [paramName, paramSymbol] = paramInfoList.at(argNumber);
@@ -537,9 +633,10 @@ std::any IRGenerator::visitLambdaFunc(const LambdaFuncNode *node) {
       paramSymbol->updateAddress(paramAddress);
     // Store the value at the new address
     insertStore(&arg, paramAddress);
-    // Generate debug info
+    // Generate debug info (the sret param is not visible in the source code)
+    const size_t diArgNumber = hasSRet && argNumber > sretArgNo ? argNumber : argNumber + 1;
     if (!isCapturesStruct)
-      diGenerator.generateLocalVarDebugInfo(paramName, paramAddress, argNumber + 1);
+      diGenerator.generateLocalVarDebugInfo(paramName, paramAddress, diArgNumber);
   }
 
   // Store the default values for optional function args
@@ -560,8 +657,12 @@ std::any IRGenerator::visitLambdaFunc(const LambdaFuncNode *node) {
 
   // Create return statement if the block is not terminated yet
   if (!blockAlreadyTerminated) {
-    llvm::Value *result = insertLoad(returnType, resultEntry->getAddress());
-    builder.CreateRet(result);
+    if (hasSRet) {
+      builder.CreateRetVoid();
+    } else {
+      llvm::Value *result = insertLoad(returnType, resultEntry->getAddress());
+      builder.CreateRet(result);
+    }
   }
 
   // Pop capture addresses
@@ -778,9 +879,17 @@ std::any IRGenerator::visitLambdaExpr(const LambdaExprNode *node) {
   if (spiceFunc.isFunction())
     returnType = spiceFunc.returnType.toLLVMType(sourceFile);
 
+  // Large structs are constructed directly in the memory of the caller, which is passed as hidden sret param
+  const bool hasSRet = spiceFunc.isFunction() && isSRetType(spiceFunc.returnType);
+  const unsigned int sretArgNo = hasCaptures ? 1 : 0;
+  if (hasSRet) {
+    paramInfoList.insert(paramInfoList.begin() + sretArgNo, {RETURN_VARIABLE_NAME, nullptr});
+    paramTypes.insert(paramTypes.begin() + sretArgNo, builder.getPtrTy());
+  }
+
   // Create function or implement declared function
   const std::string mangledName = spiceFunc.getMangledName();
-  llvm::FunctionType *funcType = llvm::FunctionType::get(returnType, paramTypes, false);
+  llvm::FunctionType *funcType = llvm::FunctionType::get(hasSRet ? builder.getVoidTy() : returnType, paramTypes, false);
   module->getOrInsertFunction(mangledName, funcType);
   llvm::Function *lambda = module->getFunction(mangledName);
 
@@ -795,6 +904,10 @@ std::any IRGenerator::visitLambdaExpr(const LambdaExprNode *node) {
     lambda->addDereferenceableParamAttr(0, module->getDataLayout().getPointerSize());
   }
 
+  // Set attributes to sret param
+  if (hasSRet)
+    addSRetParamAttrs(lambda, sretArgNo, returnType);
+
   // Add debug info
   diGenerator.generateFunctionDebugInfo(lambda, &spiceFunc, true);
   diGenerator.setSourceLocation(node);
@@ -815,6 +928,9 @@ std::any IRGenerator::visitLambdaExpr(const LambdaExprNode *node) {
   // Save values of parameters to locals
   llvm::Value *captureStructPtrPtr = nullptr;
   for (auto &arg : lambda->args()) {
+    // The sret param is only used to store the result of the expression
+    if (arg.hasStructRetAttr())
+      continue;
     // Get information about the parameter
     const size_t argNumber = arg.getArgNo();
     auto [paramName, paramSymbol] = paramInfoList.at(argNumber);
@@ -829,9 +945,10 @@ std::any IRGenerator::visitLambdaExpr(const LambdaExprNode *node) {
       paramSymbol->updateAddress(paramAddress);
     // Store the value at the new address
     insertStore(&arg, paramAddress);
-    // Generate debug info
+    // Generate debug info (the sret param is not visible in the source code)
+    const size_t diArgNumber = hasSRet && argNumber > sretArgNo ? argNumber : argNumber + 1;
     if (!isCapturesStruct)
-      diGenerator.generateLocalVarDebugInfo(paramName, paramAddress, argNumber + 1);
+      diGenerator.generateLocalVarDebugInfo(paramName, paramAddress, diArgNumber);
   }
 
   // Store the default values for optional function args
@@ -848,8 +965,14 @@ std::any IRGenerator::visitLambdaExpr(const LambdaExprNode *node) {
   }
 
   // Visit lambda expression
-  llvm::Value *exprResult = resolveValue(node->lambdaExpr);
-  builder.CreateRet(exprResult);
+  if (hasSRet) {
+    llvm::Value *exprResultAddress = resolveAddress(node->lambdaExpr);
+    generateShallowCopy(exprResultAddress, returnType, lambda->getArg(sretArgNo), false);
+    builder.CreateRetVoid();
+  } else {
+    llvm::Value *exprResult = resolveValue(node->lambdaExpr);
+    builder.CreateRet(exprResult);
+  }
 
   // Pop capture addresses
   if (hasCaptures)
@@ -2,6 +2,8 @@
 
 #include "IRGenerator.h"
 
+#include <llvm/Analysis/ValueTracking.h>
+#include <llvm/IR/MDBuilder.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/Verifier.h>
 
@@ -31,6 +33,10 @@ IRGenerator::IRGenerator(GlobalResourceManager &resourceManager, SourceFile *sou
   // Initialize debug info generator
   if (cliOptions.generateDebugInfo)
     diGenerator.initialize(sourceFile->fileName, sourceFile->fileDir);
+
+  // Initialize type-based alias analysis metadata. Only optimized builds can make use of it
+  if (cliOptions.optLevel > OptLevel::O0)
+    initializeTBAA();
 }
 
 std::any IRGenerator::visitEntry(const EntryNode *node) {
@@ -87,12 +93,17 @@ llvm::Value *IRGenerator::insertAlloca(llvm::Type *llvmType, std::string varName
 
 llvm::Value *IRGenerator::insertLoad(llvm::Type *llvmType, llvm::Value *ptr, bool isVolatile, const std::string &varName) const {
   assert(ptr->getType()->isPointerTy());
-  return builder.CreateLoad(llvmType, ptr, isVolatile, cliOptions.namesForIRValues ? varName : "");
+  llvm::LoadInst *load = builder.CreateLoad(llvmType, ptr, isVolatile, cliOptions.namesForIRValues ? varName : "");
+  if (llvm::MDNode *tbaaTag = getTBAATag(llvmType, ptr); tbaaTag && !isVolatile)
+    load->setMetadata(llvm::LLVMContext::MD_tbaa, tbaaTag);
+  return load;
 }
 
 void IRGenerator::insertStore(llvm::Value *val, llvm::Value *ptr, bool isVolatile) const {
   assert(ptr->getType()->isPointerTy());
-  builder.CreateStore(val, ptr, isVolatile);
+  llvm::StoreInst *store = builder.CreateStore(val, ptr, isVolatile);
+  if (llvm::MDNode *tbaaTag = getTBAATag(val->getType(), ptr); tbaaTag && !isVolatile)
+    store->setMetadata(llvm::LLVMContext::MD_tbaa, tbaaTag);
 }
 
 llvm::Value *IRGenerator::insertInBoundsGEP(llvm::Type *type, llvm::Value *basePtr, llvm::ArrayRef<llvm::Value *> indices,
@@ -125,6 +136,143 @@ llvm::Value *IRGenerator::insertStructGEP(llvm::Type *type, llvm::Value *basePtr
   return builder.CreateStructGEP(type, basePtr, index, varName);
 }
 
+llvm::Value *IRGenerator::insertSimdLoad(const QualType &vectorSTy, llvm::Value *arrayPtr) const {
+  assert(vectorSTy.isSimdVector());
+  assert(arrayPtr->getType()->isPointerTy());
+  llvm::Type *elementType = vectorSTy.getContained().toLLVMType(sourceFile);
+  llvm::Type *vectorType = llvm::FixedVectorType::get(elementType, vectorSTy.getArraySize());
+
+  // Arrays are only aligned like their elements, so we must not rely on the natural alignment of the vector type
+  const llvm::Align alignment = module->getDataLayout().getABITypeAlign(elementType);
+  return builder.CreateAlignedLoad(vectorType, arrayPtr, alignment);
+}
+
+llvm::Value *IRGenerator::materializeSimdVector(const QualType &vectorSTy, llvm::Value *vector) {
+  assert(vectorSTy.isSimdVector());
+  assert(vector->getType()->isVectorTy());
+  llvm::Type *arrayType = vectorSTy.toLLVMType(sourceFile);
+
+  // Vectors of numeric types have the same memory layout as arrays, so we can spill them and reload them as array value
+  llvm::Value *arrayPtr = insertAlloca(arrayType, "simd.tmp");
+  const llvm::Align alignment = module->getDataLayout().getABITypeAlign(vector->getType()->getScalarType());
+  builder.CreateAlignedStore(vector, arrayPtr, alignment);
+  return insertLoad(arrayType, arrayPtr);
+}
+
+/**
+ * Build the type descriptors for type-based alias analysis. Each scalar Spice type gets its own type descriptor, which
+ * only aliases itself and the omnipotent char type. The byte and char types are represented by the omnipotent char type,
+ * because Spice code uses them to access raw memory of any other type.
+ */
+void IRGenerator::initializeTBAA() {
+  llvm::MDBuilder mdBuilder(context);
+  llvm::MDNode *root = mdBuilder.createTBAARoot("Spice TBAA");
+  llvm::MDNode *charTypeNode = mdBuilder.createTBAAScalarTypeNode("omnipotent char", root);
+  const auto createScalarTag = [&](const std::string &typeName) {
+    llvm::MDNode *typeNode = mdBuilder.createTBAAScalarTypeNode(typeName, charTypeNode);
+    return mdBuilder.createTBAAStructTagNode(typeNode, typeNode, 0);
+  };
+
+  tbaaTags.charTag = mdBuilder.createTBAAStructTagNode(charTypeNode, charTypeNode, 0);
+  tbaaTags.boolTag = createScalarTag("bool");
+  tbaaTags.shortTag = createScalarTag("short");
+  tbaaTags.intTag = createScalarTag("int");
+  tbaaTags.longTag = createScalarTag("long");
+  tbaaTags.doubleTag = createScalarTag("double");
+  tbaaTags.ptrTag = createScalarTag("any pointer");
+}
+
+/**
+ * Get the TBAA access tag for a memory access with the given type. Signedness does not matter for aliasing, so the LLVM
+ * type is sufficient to identify the scalar Spice type. Aggregates are accessed without tag, to stay conservative.
+ *
+ * Spice has no strict aliasing rule, so memory may be accessed as any type through a casted pointer. The access type is
+ * only trusted for variables, whose address was never casted. All other accesses get the omnipotent char tag.
+ *
+ * @param accessType Loaded or stored type
+ * @param ptr Accessed address
+ * @return TBAA access tag or nullptr
+ */
+llvm::MDNode *IRGenerator::getTBAATag(const llvm::Type *accessType, const llvm::Value *ptr) const {
+  const llvm::Value *object = llvm::getUnderlyingObject(ptr);
+  if (!llvm::isa<llvm::AllocaInst, llvm::GlobalVariable>(object) || punnedObjects.contains(object))
+    return tbaaTags.charTag;
+  if (accessType->isPointerTy())
+    return tbaaTags.ptrTag;
+  if (accessType->isDoubleTy())
+    return tbaaTags.doubleTag;
+  if (accessType->isIntegerTy()) {
+    switch (accessType->getIntegerBitWidth()) {
+    case 1:
+      return tbaaTags.boolTag;
+    case 8:
+      return tbaaTags.charTag;
+    case 16:
+      return tbaaTags.shortTag;
+    case 32:
+      return tbaaTags.intTag;
+    case 64:
+      return tbaaTags.longTag;
+    default:
+      return nullptr;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * Attach attributes to all reference params of a function. References can never be null and always point to a valid
+ * instance of the referenced type.
+ *
+ * @param fct LLVM function
+ * @param paramTypes Spice param types
+ * @param argOffset Number of implicit args before the first param (e.g. 'this')
+ */
+void IRGenerator::addRefParamAttrs(llvm::Function *fct, const QualTypeList &paramTypes, unsigned int argOffset) const {
+  for (size_t i = 0; i < paramTypes.size(); i++) {
+    const QualType &paramType = paramTypes.at(i);
+    if (!paramType.isRef())
+      continue;
+    const unsigned int argNo = argOffset + i;
+    fct->addParamAttr(argNo, llvm::Attribute::NoUndef);
+    fct->addParamAttr(argNo, llvm::Attribute::NonNull);
+    llvm::Type *referencedType = paramType.getContained().toLLVMType(sourceFile);
+    if (!referencedType->isSized())
+      continue;
+    fct->addDereferenceableParamAttr(argNo, module->getDataLayout().getTypeStoreSize(referencedType));
+    fct->addParamAttr(argNo, llvm::Attribute::getWithAlignment(context, module->getDataLayout().getABITypeAlign(referencedType)));
+  }
+}
+
+/**
+ * Check if a function with the given return type hands over its result via a hidden sret pointer param. This is the case
+ * for all structs, that do not fit into two registers. The result variable of such a function is constructed directly in
+ * the memory, provided by the caller. External functions always keep the C ABI and never use this mechanism.
+ *
+ * @param returnType Spice return type
+ * @return Return via sret or not
+ */
+bool IRGenerator::isSRetType(const QualType &returnType) const {
+  if (!returnType.is(TY_STRUCT))
+    return false;
+  llvm::Type *structType = returnType.toLLVMType(sourceFile);
+  return module->getDataLayout().getTypeAllocSize(structType) > MAX_DIRECT_RETURN_SIZE;
+}
+
+/**
+ * Attach attributes to the sret param of a function. The caller provides fresh, exclusively owned memory for the result.
+ *
+ * @param fct LLVM function
+ * @param argNo Index of the sret param
+ * @param structType Returned struct type
+ */
+void IRGenerator::addSRetParamAttrs(llvm::Function *fct, unsigned int argNo, llvm::Type *structType) const {
+  fct->addParamAttr(argNo, llvm::Attribute::getWithStructRetType(context, structType));
+  fct->addParamAttr(argNo, llvm::Attribute::NoAlias);
+  fct->addParamAttr(argNo, llvm::Attribute::NonNull);
+  fct->addParamAttr(argNo, llvm::Attribute::getWithAlignment(context, module->getDataLayout().getABITypeAlign(structType)));
+}
+
 llvm::Value *IRGenerator::resolveValue(const ExprNode *node) {
   // Visit the given AST node
   auto exprResult = any_cast<LLVMExprResult>(visit(node));
@@ -580,6 +728,20 @@ void IRGenerator::materializeConstant(LLVMExprResult &exprResult) {
 }
 
 std::string IRGenerator::getIRString(llvm::Module *llvmModule, bool withoutTargetData) {
+  std::string output;
+  llvm::raw_string_ostream oss(output);
+  printIR(oss, llvmModule, withoutTargetData);
+  return output;
+}
+
+/**
+ * Print the IR of the given module directly to an output stream, without materializing it as a string first
+ *
+ * @param os Output stream
+ * @param llvmModule LLVM module to print
+ * @param withoutTargetData Omit the target triple and data layout
+ */
+void IRGenerator::printIR(llvm::raw_ostream &os, llvm::Module *llvmModule, bool withoutTargetData) {
   assert(llvmModule != nullptr); // Make sure the module hasn't been moved away
 
   // Backup target triple and data layout
@@ -591,18 +753,14 @@ std::string IRGenerator::getIRString(llvm::Module *llvmModule, bool withoutTarge
     llvmModule->setDataLayout("");
   }
 
-  // Get IR string
-  std::string output;
-  llvm::raw_string_ostream oss(output);
-  llvmModule->print(oss, nullptr);
+  // Print IR
+  llvmModule->print(os, nullptr);
 
   // Restore target triple and data layout
   if (withoutTargetData) {
     llvmModule->setTargetTriple(targetTriple);
     llvmModule->setDataLayout(targetDataLayout);
   }
-
-  return output;
 }
 
 /**
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include <CompilerPass.h>
 #include <ast/ParallelizableASTVisitor.h>
 #include <irgenerator/DebugInfoGenerator.h>
@@ -18,6 +20,11 @@ class ExprNode;
 const char *const ANON_GLOBAL_STRING_NAME = "anon.string.";
 const char *const ANON_GLOBAL_ARRAY_NAME = "anon.array.";
 const char *const CAPTURES_PARAM_NAME = "captures";
+// String object layout, keep in sync with std/runtime/string_rt.spice
+static constexpr uint64_t STROBJ_INLINE_LENGTH_SHIFT = 56;
+static constexpr uint64_t STROBJ_LONG_LENGTH_MASK = 0x7FFFFFFFFFFFFFFF;
+// Structs, exceeding this size, are returned via a hidden sret pointer param instead of registers
+static constexpr uint64_t MAX_DIRECT_RETURN_SIZE = 16;
 static const std::string PRODUCER_STRING = "spice version " + std::string(SPICE_VERSION) + " (https://github.com/spicelang/spice)";
 
 enum Likeliness : uint8_t {
@@ -89,6 +96,9 @@ public:
   std::any visitLenCall(const LenCallNode *node) override;
   std::any visitPanicCall(const PanicCallNode *node) override;
   std::any visitSysCall(const SysCallNode *node) override;
+  std::any visitShuffleCall(const ShuffleCallNode *node) override;
+  std::any visitReduceCall(const ReduceCallNode *node) override;
+  std::any visitAtomicCall(const AtomicCallNode *node) override;
   // Expressions
   std::any visitAssignExpr(const AssignExprNode *node) override;
   std::any visitTernaryExpr(const TernaryExprNode *node) override;
@@ -124,6 +134,8 @@ public:
   llvm::Value *insertInBoundsGEP(llvm::Type *type, llvm::Value *basePtr, llvm::ArrayRef<llvm::Value *> indices,
                                  std::string varName = "") const;
   llvm::Value *insertStructGEP(llvm::Type *type, llvm::Value *basePtr, unsigned index, std::string varName = "") const;
+  llvm::Value *insertSimdLoad(const QualType &vectorSTy, llvm::Value *arrayPtr) const;
+  llvm::Value *materializeSimdVector(const QualType &vectorSTy, llvm::Value *vector);
   llvm::Value *resolveValue(const ExprNode *node);
   llvm::Value *resolveValue(const ExprNode *node, LLVMExprResult &exprResult) const;
   llvm::Value *resolveValue(const QualType &qualType, LLVMExprResult &exprResult) const;
@@ -131,6 +143,7 @@ public:
   llvm::Value *resolveAddress(LLVMExprResult &exprResult);
   [[nodiscard]] llvm::Constant *getDefaultValueForSymbolType(const QualType &symbolType);
   [[nodiscard]] static std::string getIRString(llvm::Module *llvmModule, bool withoutTargetInfo);
+  static void printIR(llvm::raw_ostream &os, llvm::Module *llvmModule, bool withoutTargetInfo);
 
 private:
   // Private methods
@@ -141,6 +154,11 @@ private:
   void insertJump(llvm::BasicBlock *targetBlock);
   void insertCondJump(llvm::Value *condition, llvm::BasicBlock *trueBlock, llvm::BasicBlock *falseBlock,
                       Likeliness likeliness = UNSPECIFIED);
+  void initializeTBAA();
+  [[nodiscard]] llvm::MDNode *getTBAATag(const llvm::Type *accessType, const llvm::Value *ptr) const;
+  void addRefParamAttrs(llvm::Function *fct, const QualTypeList &paramTypes, unsigned int argOffset) const;
+  [[nodiscard]] bool isSRetType(const QualType &returnType) const;
+  void addSRetParamAttrs(llvm::Function *fct, unsigned int argNo, llvm::Type *structType) const;
   void verifyFunction(const llvm::Function *fct, const CodeLoc &codeLoc) const;
   void verifyModule(const CodeLoc &codeLoc) const;
   LLVMExprResult doAssignment(const ASTNode *lhsNode, const ExprNode *rhsNode, const ASTNode *node);
@@ -161,13 +179,19 @@ private:
 
   // Generate implicit
   llvm::Value *doImplicitCast(llvm::Value *src, QualType dstSTy, QualType srcSTy);
+  void generateStringSwitchDispatch(const SwitchStmtNode *node, const std::vector<llvm::BasicBlock *> &bCases,
+                                    llvm::BasicBlock *bDefault);
   void generateScopeCleanup(const StmtLstNode *node) const;
-  llvm::Value *generateFctCall(const Function *fct, const std::vector<llvm::Value *> &args) const;
+  void generateLifetimeEndMarkers(const StmtLstNode *declStmtLst) const;
   void generateProcCall(const Function *proc, std::vector<llvm::Value *> &args) const;
   void generateCtorOrDtorCall(const SymbolTableEntry *entry, const Function *ctorOrDtor,
                               const std::vector<llvm::Value *> &args) const;
   void generateCtorOrDtorCall(llvm::Value *structAddr, const Function *ctorOrDtor, const std::vector<llvm::Value *> &args) const;
   void generateDeallocCall(llvm::Value *variableAddress) const;
+  std::pair<llvm::Value *, llvm::Value *> generateStringObjDataAccess(llvm::Value *stringObjPtr, llvm::Type *stringObjType) const;
+  llvm::Value *generateStringObjCharsAccess(llvm::Value *stringObjPtr, llvm::Type *stringObjType) const;
+  llvm::Value *generateStringObjLengthFieldLoad(llvm::Value *stringObjPtr, llvm::Type *stringObjType) const;
+  llvm::Value *generateStringObjCharsSelect(llvm::Value *stringObjPtr, llvm::Type *stringObjType, llvm::Value *isLongMode) const;
   llvm::Function *generateImplicitFunction(const std::function<void(void)> &generateBody, const Function *spiceFunc);
   llvm::Function *generateImplicitProcedure(const std::function<void(void)> &generateBody, const Function *spiceProc);
   void generateCtorBodyPreamble(Scope *bodyScope);
@@ -187,6 +211,10 @@ private:
   llvm::Constant *generateTypeInfo(StructBase *spiceStruct) const;
   llvm::Constant *generateVTable(StructBase *spiceStruct) const;
   void generateVTableInitializer(const StructBase *spiceStruct) const;
+  std::pair<const Struct *, llvm::Function *> getDevirtualizationTarget(const QualType &interfaceType,
+                                                                      const Function *virtualMethod,
+                                                                      llvm::FunctionType *fctType) const;
+  llvm::Constant *getVTableAddressPoint(const StructBase *spiceStruct) const;
 
   // Private members
   llvm::LLVMContext &context;
@@ -198,6 +226,16 @@ private:
   struct CommonLLVMTypes {
     llvm::StructType *fatPtrType = nullptr;
   } llvmTypes;
+  struct TBAATags {
+    llvm::MDNode *charTag = nullptr;
+    llvm::MDNode *boolTag = nullptr;
+    llvm::MDNode *shortTag = nullptr;
+    llvm::MDNode *intTag = nullptr;
+    llvm::MDNode *longTag = nullptr;
+    llvm::MDNode *doubleTag = nullptr;
+    llvm::MDNode *ptrTag = nullptr;
+  } tbaaTags;
+  std::unordered_set<const llvm::Value *> punnedObjects;
   std::vector<llvm::BasicBlock *> breakBlocks;
   std::vector<llvm::BasicBlock *> continueBlocks;
   std::stack<llvm::BasicBlock *> fallthroughBlocks;
@@ -67,6 +67,10 @@ LLVMExprResult OpRuleConversionManager::getPlusEqualInst(const ASTNode *node, LL
     llvm::Value *rhsVExt = builder.CreateIntCast(rhsV(), builder.getInt64Ty(), rhsSTy.isSigned());
     return {.value = builder.CreateGEP(elementTy, lhsV(), rhsVExt)};
   }
+  case COMB(TY_ARRAY, TY_ARRAY): {
+    const bool isFP = lhsSTy.getContained().is(TY_DOUBLE);
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, isFP ? llvm::Instruction::FAdd : llvm::Instruction::Add)};
+  }
   default:                                                             // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: +="); // GCOV_EXCL_LINE
   }
@@ -123,6 +127,10 @@ LLVMExprResult OpRuleConversionManager::getMinusEqualInst(const ASTNode *node, L
     llvm::Value *rhsVNeg = builder.CreateNeg(rhsVExt);
     return {.value = builder.CreateGEP(elementTy, lhsV(), rhsVNeg)};
   }
+  case COMB(TY_ARRAY, TY_ARRAY): {
+    const bool isFP = lhsSTy.getContained().is(TY_DOUBLE);
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, isFP ? llvm::Instruction::FSub : llvm::Instruction::Sub)};
+  }
   default:                                                             // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: -="); // GCOV_EXCL_LINE
   }
@@ -170,6 +178,10 @@ LLVMExprResult OpRuleConversionManager::getMulEqualInst(const ASTNode *node, LLV
   case COMB(TY_LONG, TY_LONG): // fallthrough
   case COMB(TY_BYTE, TY_BYTE):
     return {.value = builder.CreateMul(lhsV(), rhsV(), "", false, lhsSTy.isSigned() && rhsSTy.isSigned())};
+  case COMB(TY_ARRAY, TY_ARRAY): {
+    const bool isFP = lhsSTy.getContained().is(TY_DOUBLE);
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, isFP ? llvm::Instruction::FMul : llvm::Instruction::Mul)};
+  }
   default:                                                             // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: *="); // GCOV_EXCL_LINE
   }
@@ -217,6 +229,13 @@ LLVMExprResult OpRuleConversionManager::getDivEqualInst(const ASTNode *node, LLV
   case COMB(TY_LONG, TY_LONG): // fallthrough
   case COMB(TY_BYTE, TY_BYTE):
     return {.value = generateDiv(lhsSTy, rhsSTy, lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY): {
+    const QualType elementSTy = lhsSTy.getContained();
+    llvm::Instruction::BinaryOps opcode = llvm::Instruction::FDiv;
+    if (!elementSTy.is(TY_DOUBLE))
+      opcode = elementSTy.isSigned() ? llvm::Instruction::SDiv : llvm::Instruction::UDiv;
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, opcode)};
+  }
   default:                                                             // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: /="); // GCOV_EXCL_LINE
   }
@@ -258,6 +277,13 @@ LLVMExprResult OpRuleConversionManager::getRemEqualInst(const ASTNode *node, LLV
   case COMB(TY_LONG, TY_LONG): // fallthrough
   case COMB(TY_BYTE, TY_BYTE):
     return {.value = generateRem(lhsSTy, rhsSTy, lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY): {
+    const QualType elementSTy = lhsSTy.getContained();
+    llvm::Instruction::BinaryOps opcode = llvm::Instruction::FRem;
+    if (!elementSTy.is(TY_DOUBLE))
+      opcode = elementSTy.isSigned() ? llvm::Instruction::SRem : llvm::Instruction::URem;
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, opcode)};
+  }
   default:                                                             // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: %="); // GCOV_EXCL_LINE
   }
@@ -291,6 +317,8 @@ LLVMExprResult OpRuleConversionManager::getSHLEqualInst(const ASTNode *node, LLV
   case COMB(TY_LONG, TY_LONG): // fallthrough
   case COMB(TY_BYTE, TY_BYTE):
     return {.value = builder.CreateShl(lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY):
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, llvm::Instruction::Shl)};
   default:                                                              // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: <<="); // GCOV_EXCL_LINE
   }
@@ -324,6 +352,10 @@ LLVMExprResult OpRuleConversionManager::getSHREqualInst(const ASTNode *node, LLV
   case COMB(TY_LONG, TY_LONG): // fallthrough
   case COMB(TY_BYTE, TY_BYTE):
     return {.value = generateSHR(lhsSTy, rhsSTy, lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY): {
+    const bool isSigned = lhsSTy.getContained().isSigned();
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, isSigned ? llvm::Instruction::AShr : llvm::Instruction::LShr)};
+  }
   default:                                                              // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: >>="); // GCOV_EXCL_LINE
   }
@@ -357,6 +389,8 @@ LLVMExprResult OpRuleConversionManager::getAndEqualInst(const ASTNode *node, LLV
   case COMB(TY_LONG, TY_LONG): // fallthrough
   case COMB(TY_BYTE, TY_BYTE):
     return {.value = builder.CreateAnd(lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY):
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, llvm::Instruction::And)};
   default:                                                             // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: &="); // GCOV_EXCL_LINE
   }
@@ -390,6 +424,8 @@ LLVMExprResult OpRuleConversionManager::getOrEqualInst(const ASTNode *node, LLVM
   case COMB(TY_LONG, TY_LONG): // fallthrough
   case COMB(TY_BYTE, TY_BYTE):
     return {.value = builder.CreateOr(lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY):
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, llvm::Instruction::Or)};
   default:                                                             // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: |="); // GCOV_EXCL_LINE
   }
@@ -424,6 +460,8 @@ LLVMExprResult OpRuleConversionManager::getXorEqualInst(const ASTNode *node, LLV
   case COMB(TY_BYTE, TY_BYTE): // fallthrough
   case COMB(TY_CHAR, TY_CHAR):
     return {.value = builder.CreateXor(lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY):
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, llvm::Instruction::Xor)};
   default:                                                             // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: ^="); // GCOV_EXCL_LINE
   }
@@ -443,6 +481,8 @@ LLVMExprResult OpRuleConversionManager::getBitwiseOrInst(const ASTNode *node, LL
   case COMB(TY_BYTE, TY_BYTE):   // fallthrough
   case COMB(TY_BOOL, TY_BOOL):
     return {.value = builder.CreateOr(lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY):
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, llvm::Instruction::Or)};
   default:                                                            // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: |"); // GCOV_EXCL_LINE
   }
@@ -462,6 +502,8 @@ LLVMExprResult OpRuleConversionManager::getBitwiseXorInst(const ASTNode *node, L
   case COMB(TY_BYTE, TY_BYTE):   // fallthrough
   case COMB(TY_BOOL, TY_BOOL):
     return {.value = builder.CreateXor(lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY):
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, llvm::Instruction::Xor)};
   default:                                                            // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: ^"); // GCOV_EXCL_LINE
   }
@@ -481,6 +523,8 @@ LLVMExprResult OpRuleConversionManager::getBitwiseAndInst(const ASTNode *node, L
   case COMB(TY_BYTE, TY_BYTE):   // fallthrough
   case COMB(TY_BOOL, TY_BOOL):
     return {.value = builder.CreateAnd(lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY):
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, llvm::Instruction::And)};
   default:                                                            // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: &"); // GCOV_EXCL_LINE
   }
@@ -1052,6 +1096,8 @@ LLVMExprResult OpRuleConversionManager::getShiftLeftInst(const ASTNode *node, LL
   }
   case COMB(TY_BYTE, TY_BYTE):
     return {.value = builder.CreateShl(lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY):
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, llvm::Instruction::Shl)};
   default:                                                             // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: <<"); // GCOV_EXCL_LINE
   }
@@ -1098,6 +1144,10 @@ LLVMExprResult OpRuleConversionManager::getShiftRightInst(const ASTNode *node, L
   }
   case COMB(TY_BYTE, TY_BYTE):
     return {.value = generateSHR(lhsSTy, rhsSTy, lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY): {
+    const bool isSigned = lhsSTy.getContained().isSigned();
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, isSigned ? llvm::Instruction::AShr : llvm::Instruction::LShr)};
+  }
   default:                                                             // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: >>"); // GCOV_EXCL_LINE
   }
@@ -1187,6 +1237,10 @@ LLVMExprResult OpRuleConversionManager::getPlusInst(const ASTNode *node, LLVMExp
     llvm::Value *rhsExt = builder.CreateIntCast(rhsV(), builder.getInt64Ty(), rhsSTy.isSigned());
     return {.value = builder.CreateGEP(lhsSTy.getContained().toLLVMType(irGenerator->sourceFile), lhsV(), rhsExt)};
   }
+  case COMB(TY_ARRAY, TY_ARRAY): {
+    const bool isFP = lhsSTy.getContained().is(TY_DOUBLE);
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, isFP ? llvm::Instruction::FAdd : llvm::Instruction::Add)};
+  }
   default:                                                            // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: +"); // GCOV_EXCL_LINE
   }
@@ -1276,6 +1330,10 @@ LLVMExprResult OpRuleConversionManager::getMinusInst(const ASTNode *node, LLVMEx
     llvm::Value *rhsExt = builder.CreateIntCast(rhsV(), builder.getInt64Ty(), rhsSTy.isSigned());
     return {.value = builder.CreateGEP(lhsSTy.getContained().toLLVMType(irGenerator->sourceFile), lhsV(), rhsExt)};
   }
+  case COMB(TY_ARRAY, TY_ARRAY): {
+    const bool isFP = lhsSTy.getContained().is(TY_DOUBLE);
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, isFP ? llvm::Instruction::FSub : llvm::Instruction::Sub)};
+  }
   default:                                                            // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: -"); // GCOV_EXCL_LINE
   }
@@ -1345,6 +1403,10 @@ LLVMExprResult OpRuleConversionManager::getMulInst(const ASTNode *node, LLVMExpr
   case COMB(TY_LONG, TY_LONG): // fallthrough
   case COMB(TY_BYTE, TY_BYTE):
     return {.value = builder.CreateMul(lhsV(), rhsV(), "", false, lhsSTy.isSigned() && rhsSTy.isSigned())};
+  case COMB(TY_ARRAY, TY_ARRAY): {
+    const bool isFP = lhsSTy.getContained().is(TY_DOUBLE);
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, isFP ? llvm::Instruction::FMul : llvm::Instruction::Mul)};
+  }
   default:                                                            // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: *"); // GCOV_EXCL_LINE
   }
@@ -1415,6 +1477,13 @@ LLVMExprResult OpRuleConversionManager::getDivInst(const ASTNode *node, LLVMExpr
   case COMB(TY_BYTE, TY_BYTE): // fallthrough
   case COMB(TY_CHAR, TY_CHAR):
     return {.value = builder.CreateSDiv(lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY): {
+    const QualType elementSTy = lhsSTy.getContained();
+    llvm::Instruction::BinaryOps opcode = llvm::Instruction::FDiv;
+    if (!elementSTy.is(TY_DOUBLE))
+      opcode = elementSTy.isSigned() ? llvm::Instruction::SDiv : llvm::Instruction::UDiv;
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, opcode)};
+  }
   default:                                                            // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: /"); // GCOV_EXCL_LINE
   }
@@ -1459,6 +1528,13 @@ LLVMExprResult OpRuleConversionManager::getRemInst(const ASTNode *node, LLVMExpr
   }
   case COMB(TY_LONG, TY_LONG):
     return {.value = generateRem(lhsSTy, rhsSTy, lhsV(), rhsV())};
+  case COMB(TY_ARRAY, TY_ARRAY): {
+    const QualType elementSTy = lhsSTy.getContained();
+    llvm::Instruction::BinaryOps opcode = llvm::Instruction::FRem;
+    if (!elementSTy.is(TY_DOUBLE))
+      opcode = elementSTy.isSigned() ? llvm::Instruction::SRem : llvm::Instruction::URem;
+    return {.value = generateSimdOp(lhsSTy, lhs, rhs, opcode)};
+  }
   default:                                                            // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "Operator fallthrough: %"); // GCOV_EXCL_LINE
   }
@@ -1692,23 +1768,36 @@ LLVMExprResult OpRuleConversionManager::callOperatorOverloadFct(const ASTNode *n
   const std::string mangledName = opFct->getMangledName();
   assert(opFct->entry->scope != nullptr);
 
+  // Large structs are constructed by the callee directly in the result memory, which we pass as hidden sret param
+  const bool hasSRet = irGenerator->isSRetType(opFct->returnType);
+  llvm::Type *sretType = nullptr;
+  llvm::Value *sretPtr = nullptr;
+  std::vector<llvm::Value *> argValues;
+  argValues.reserve(N + 1);
+  if (hasSRet) {
+    sretType = opFct->returnType.toLLVMType(irGenerator->sourceFile);
+    sretPtr = irGenerator->insertAlloca(sretType);
+    argValues.push_back(sretPtr);
+  }
+
   // Get arg values
   const QualTypeList &paramTypes = opFct->getParamTypes();
   assert(paramTypes.size() == N);
-  llvm::Value *argValues[N];
-  argValues[0] = paramTypes[0].isRef() ? opV[1]() : opV[0]();
+  argValues.push_back(paramTypes[0].isRef() ? opV[1]() : opV[0]());
   if constexpr (N == 2)
-    argValues[1] = paramTypes[1].isRef() ? opV[3]() : opV[2]();
+    argValues.push_back(paramTypes[1].isRef() ? opV[3]() : opV[2]());
 
   // Function is not defined in the current module -> declare it
   if (!irGenerator->module->getFunction(mangledName)) {
     // Get returnType
     llvm::Type *returnType = builder.getVoidTy();
-    if (!opFct->returnType.is(TY_DYN))
+    if (!opFct->returnType.is(TY_DYN) && !hasSRet)
       returnType = opFct->returnType.toLLVMType(irGenerator->sourceFile);
 
     // Get arg types
     std::vector<llvm::Type *> argTypes;
+    if (hasSRet)
+      argTypes.push_back(builder.getPtrTy()); // Sret pointer
     for (const QualType &paramType : opFct->getParamTypes())
       argTypes.push_back(paramType.toLLVMType(irGenerator->sourceFile));
 
@@ -1721,7 +1810,9 @@ LLVMExprResult OpRuleConversionManager::callOperatorOverloadFct(const ASTNode *n
   assert(callee != nullptr);
 
   // Generate function call
-  llvm::Value *result = builder.CreateCall(callee, argValues);
+  llvm::CallInst *result = builder.CreateCall(callee, argValues);
+  if (hasSRet)
+    result->addParamAttr(0, llvm::Attribute::getWithStructRetType(context, sretType));
 
   // If this is a procedure, return true
   if (opFct->isProcedure())
@@ -1733,12 +1824,20 @@ LLVMExprResult OpRuleConversionManager::callOperatorOverloadFct(const ASTNode *n
   if (opFct->returnType.is(TY_STRUCT)) {
     anonymousSymbol = irGenerator->currentScope->symbolTable.lookupAnonymous(node->codeLoc, opIdx);
     if (anonymousSymbol != nullptr) {
-      resultPtr = irGenerator->insertAlloca(result->getType());
-      irGenerator->insertStore(result, resultPtr);
-      anonymousSymbol->updateAddress(resultPtr);
+      if (hasSRet) {
+        anonymousSymbol->updateAddress(sretPtr);
+      } else {
+        resultPtr = irGenerator->insertAlloca(result->getType());
+        irGenerator->insertStore(result, resultPtr);
+        anonymousSymbol->updateAddress(resultPtr);
+      }
     }
   }
 
+  // In case the result was constructed in the sret memory, return the address
+  if (hasSRet)
+    return {.ptr = sretPtr, .entry = anonymousSymbol};
+
   // If the return type is reference, return the result value as refPtr
   if (opFct->returnType.isRef())
     return {.ptr = result, .refPtr = resultPtr, .entry = anonymousSymbol};
@@ -1747,6 +1846,15 @@ LLVMExprResult OpRuleConversionManager::callOperatorOverloadFct(const ASTNode *n
   return {.value = result, .ptr = resultPtr, .entry = anonymousSymbol};
 }
 
+llvm::Value *OpRuleConversionManager::generateSimdOp(const QualType &vectorSTy, LLVMExprResult &lhs, LLVMExprResult &rhs,
+                                                     llvm::Instruction::BinaryOps opcode) const {
+  // Load both operands as LLVM vectors and apply the operation to all lanes at once
+  llvm::Value *lhsVector = irGenerator->insertSimdLoad(vectorSTy, irGenerator->resolveAddress(lhs));
+  llvm::Value *rhsVector = irGenerator->insertSimdLoad(vectorSTy, irGenerator->resolveAddress(rhs));
+  llvm::Value *result = builder.CreateBinOp(opcode, lhsVector, rhsVector);
+  return irGenerator->materializeSimdVector(vectorSTy, result);
+}
+
 llvm::Value *OpRuleConversionManager::generateIToFp(const QualType &srcSTy, llvm::Value *srcV, llvm::Type *tgtT) const {
   if (srcSTy.isSigned())
     return builder.CreateSIToFP(srcV, tgtT);
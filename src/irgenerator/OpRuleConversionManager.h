@@ -96,6 +96,8 @@ private:
   const StdFunctionManager &stdFunctionManager;
 
   // Private methods
+  [[nodiscard]] llvm::Value *generateSimdOp(const QualType &vectorSTy, LLVMExprResult &lhs, LLVMExprResult &rhs,
+                                            llvm::Instruction::BinaryOps opcode) const;
   [[nodiscard]] llvm::Value *generateIToFp(const QualType &srcSTy, llvm::Value *srcV, llvm::Type *tgtT) const;
   [[nodiscard]] llvm::Value *generateSHR(const QualType &lhsSTy, const QualType &rhsSTy, llvm::Value *lhsV,
                                          llvm::Value *rhsV) const;
@@ -67,6 +67,16 @@ llvm::Function *StdFunctionManager::getMemcmpFct() const {
   return memcmpFct;
 }
 
+llvm::Function *StdFunctionManager::getStrlenFct() const {
+  llvm::Function *strlenFct = getFunction("strlen", builder.getInt64Ty(), builder.getPtrTy());
+  // Set attributes
+  strlenFct->addFnAttr(llvm::Attribute::NoUnwind);
+  strlenFct->addParamAttr(0, llvm::Attribute::NoCapture);
+  strlenFct->addParamAttr(0, llvm::Attribute::NoUndef);
+  strlenFct->addParamAttr(0, llvm::Attribute::ReadOnly);
+  return strlenFct;
+}
+
 llvm::Function *StdFunctionManager::getMemcpyIntrinsic() const {
   llvm::Type *ptrTy = builder.getPtrTy();
   llvm::Function *memcpyFct = getProcedure("llvm.memcpy.p0.p0.i64", {ptrTy, ptrTy, builder.getInt64Ty(), builder.getInt1Ty()});
@@ -108,14 +118,18 @@ llvm::Function *StdFunctionManager::getDeallocBytePtrRefFct() const {
   return getProcedure(mangledName.c_str(), {builder.getPtrTy()});
 }
 
-llvm::Function *StdFunctionManager::getIterateFct(const Function *spiceFunc) const {
+llvm::Function *StdFunctionManager::getIterateFct(const Function *spiceFunc, bool withSRet) const {
   const std::string functionName = NameMangling::mangleFunction(*spiceFunc);
+  if (withSRet) // The iterator is constructed in the memory behind the first param
+    return getProcedure(functionName.c_str(), {builder.getPtrTy(), builder.getPtrTy(), builder.getInt64Ty()});
   llvm::Type *iteratorType = spiceFunc->returnType.toLLVMType(sourceFile);
   return getFunction(functionName.c_str(), iteratorType, {builder.getPtrTy(), builder.getInt64Ty()});
 }
 
-llvm::Function *StdFunctionManager::getIteratorFct(const Function *spiceFunc) const {
+llvm::Function *StdFunctionManager::getIteratorFct(const Function *spiceFunc, bool withSRet) const {
   const std::string functionName = NameMangling::mangleFunction(*spiceFunc);
+  if (withSRet) // The iterator is constructed in the memory behind the param after 'this'
+    return getProcedure(functionName.c_str(), {builder.getPtrTy(), builder.getPtrTy()});
   llvm::Type *iteratorType = spiceFunc->returnType.toLLVMType(sourceFile);
   return getFunction(functionName.c_str(), iteratorType, builder.getPtrTy());
 }
@@ -23,13 +23,14 @@ public:
   [[nodiscard]] llvm::Function *getExitFct() const;
   [[nodiscard]] llvm::Function *getFreeFct() const;
   [[nodiscard]] llvm::Function *getMemcmpFct() const;
+  [[nodiscard]] llvm::Function *getStrlenFct() const;
   [[nodiscard]] llvm::Function *getMemcpyIntrinsic() const;
   [[nodiscard]] llvm::Function *getStringGetRawLengthStringFct() const;
   [[nodiscard]] llvm::Function *getStringIsRawEqualStringStringFct() const;
   [[nodiscard]] llvm::Function *getAllocUnsafeLongFct() const;
   [[nodiscard]] llvm::Function *getDeallocBytePtrRefFct() const;
-  [[nodiscard]] llvm::Function *getIterateFct(const Function *spiceFunc) const;
-  [[nodiscard]] llvm::Function *getIteratorFct(const Function *spiceFunc) const;
+  [[nodiscard]] llvm::Function *getIterateFct(const Function *spiceFunc, bool withSRet) const;
+  [[nodiscard]] llvm::Function *getIteratorFct(const Function *spiceFunc, bool withSRet) const;
   [[nodiscard]] llvm::Function *getIteratorGetFct(const Function *spiceFunc) const;
   [[nodiscard]] llvm::Function *getIteratorGetIdxFct(const Function *spiceFunc) const;
   [[nodiscard]] llvm::Function *getIteratorIsValidFct(const Function *spiceFunc) const;
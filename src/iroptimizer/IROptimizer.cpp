@@ -3,9 +3,14 @@
 #include "IROptimizer.h"
 
 #include <llvm/Analysis/ModuleSummaryAnalysis.h>
+#include <llvm/Support/PGOOptions.h>
+#include <llvm/Support/VirtualFileSystem.h>
 #include <llvm/Transforms/IPO/AlwaysInliner.h>
 
 #include <driver/Driver.h>
+#include <iroptimizer/passes/BoundsCheckElimPass.h>
+#include <iroptimizer/passes/DeadDeallocElimPass.h>
+#include <iroptimizer/passes/StringCopyElisionPass.h>
 
 namespace spice::compiler {
 
@@ -13,7 +18,8 @@ void IROptimizer::prepare() {
   llvm::PipelineTuningOptions pto;
   if (!resourceManager.cliOptions.testMode)
     si.registerCallbacks(pic, &moduleAnalysisMgr);
-  passBuilder = std::make_unique<llvm::PassBuilder>(sourceFile->targetMachine.get(), pto, std::nullopt, &pic);
+  passBuilder = std::make_unique<llvm::PassBuilder>(sourceFile->targetMachine.get(), pto, getPGOOptions(), &pic);
+  registerSpicePasses();
 
   functionAnalysisMgr.registerPass([&] { return passBuilder->buildDefaultAAPipeline(); });
 
@@ -67,6 +73,39 @@ void IROptimizer::optimizePostLink() {
   modulePassMgr.run(ltoModule, moduleAnalysisMgr);
 }
 
+/**
+ * Register the Spice-specific passes, that make use of knowledge about the Spice runtime, which LLVM does not have
+ */
+void IROptimizer::registerSpicePasses() const {
+  // String copy elision has to run before inlining, so that the String runtime calls are still recognizable
+  passBuilder->registerPipelineStartEPCallback([](llvm::ModulePassManager &modulePassMgr, llvm::OptimizationLevel) {
+    modulePassMgr.addPass(llvm::createModuleToFunctionPassAdaptor(StringCopyElisionPass()));
+  });
+  // Dead dealloc elimination benefits from previous simplifications and is cheap, so it runs as peephole pass
+  passBuilder->registerPeepholeEPCallback([](llvm::FunctionPassManager &functionPassMgr, llvm::OptimizationLevel) {
+    functionPassMgr.addPass(DeadDeallocElimPass());
+  });
+  // Bounds check elimination needs the size loads to be hoisted by LICM/GVN and has to run before vectorization
+  passBuilder->registerScalarOptimizerLateEPCallback([](llvm::FunctionPassManager &functionPassMgr, llvm::OptimizationLevel) {
+    functionPassMgr.addPass(BoundsCheckElimPass());
+  });
+}
+
+/**
+ * Build the PGO options for the pass builder, based on the cli options.
+ * As the same pass builder builds the default, pre-link and post-link pipelines, all of them are covered.
+ *
+ * @return PGO options or std::nullopt if PGO is disabled
+ */
+std::optional<llvm::PGOOptions> IROptimizer::getPGOOptions() const {
+  llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> fileSystem = llvm::vfs::getRealFileSystem();
+  if (cliOptions.pgoInstrGen) // Empty profile file name means default_%m.profraw
+    return llvm::PGOOptions("", "", "", "", fileSystem, llvm::PGOOptions::IRInstr);
+  if (!cliOptions.pgoProfileUsePath.empty())
+    return llvm::PGOOptions(cliOptions.pgoProfileUsePath.string(), "", "", "", fileSystem, llvm::PGOOptions::IRUse);
+  return std::nullopt;
+}
+
 llvm::OptimizationLevel IROptimizer::getLLVMOptLevelFromSpiceOptLevel() const {
   switch (cliOptions.optLevel) {
   case O1:
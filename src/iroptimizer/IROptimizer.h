@@ -40,6 +40,8 @@ private:
   std::unique_ptr<llvm::PassBuilder> passBuilder;
 
   // Private methods
+  void registerSpicePasses() const;
+  [[nodiscard]] std::optional<llvm::PGOOptions> getPGOOptions() const;
   [[nodiscard]] llvm::OptimizationLevel getLLVMOptLevelFromSpiceOptLevel() const;
 };
 
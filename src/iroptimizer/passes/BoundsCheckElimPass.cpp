@@ -0,0 +1,81 @@
+// Copyright (c) 2021-2025 ChilliBits. All rights reserved.
+
+#include "BoundsCheckElimPass.h"
+
+#include <llvm/Analysis/ScalarEvolution.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Instructions.h>
+
+namespace spice::compiler {
+
+llvm::PreservedAnalyses BoundsCheckElimPass::run(llvm::Function &function, llvm::FunctionAnalysisManager &functionAnalysisMgr) {
+  llvm::ScalarEvolution &scalarEvolution = functionAnalysisMgr.getResult<llvm::ScalarEvolutionAnalysis>(function);
+
+  // Collect all checks, that can never take the panic path
+  std::vector<std::pair<llvm::BranchInst *, bool>> redundantChecks;
+  for (llvm::BasicBlock &block : function) {
+    auto *branch = llvm::dyn_cast<llvm::BranchInst>(block.getTerminator());
+    if (!branch || !branch->isConditional() || !llvm::isa<llvm::ICmpInst>(branch->getCondition()))
+      continue;
+    const bool panicsOnTrue = isPanicBlock(branch->getSuccessor(0));
+    const bool panicsOnFalse = isPanicBlock(branch->getSuccessor(1));
+    if (panicsOnTrue == panicsOnFalse)
+      continue;
+    if (isProvablyInRange(branch, panicsOnTrue, scalarEvolution))
+      redundantChecks.emplace_back(branch, panicsOnTrue);
+  }
+
+  if (redundantChecks.empty())
+    return llvm::PreservedAnalyses::all();
+
+  // Fold the conditions to constants. The now dead panic blocks are cleaned up by SimplifyCFG afterward
+  for (const auto &[branch, panicsOnTrue] : redundantChecks) {
+    llvm::Constant *safeCondition = llvm::ConstantInt::getBool(branch->getContext(), !panicsOnTrue);
+    branch->setCondition(safeCondition);
+  }
+
+  llvm::PreservedAnalyses preservedAnalyses;
+  preservedAnalyses.preserveSet<llvm::CFGAnalyses>();
+  return preservedAnalyses;
+}
+
+/**
+ * Check if the given block is a panic block. Such a block ends with an unreachable terminator, which is preceded by a
+ * call to a function, that does not return (e.g. exit).
+ *
+ * @param block Block to check
+ * @return Panic block or not
+ */
+bool BoundsCheckElimPass::isPanicBlock(const llvm::BasicBlock *block) {
+  const llvm::Instruction *terminator = block->getTerminator();
+  if (!llvm::isa<llvm::UnreachableInst>(terminator))
+    return false;
+  const auto *call = llvm::dyn_cast_or_null<llvm::CallInst>(terminator->getPrevNode());
+  return call && call->doesNotReturn();
+}
+
+/**
+ * Check if the comparison of the given branch is known to always select the non-panicking successor at the
+ * position of the branch.
+ *
+ * @param branch Conditional branch with an icmp condition
+ * @param panicsOnTrue True if the panic path is taken, when the condition holds
+ * @param scalarEvolution Scalar evolution analysis result
+ * @return Provably in range or not
+ */
+bool BoundsCheckElimPass::isProvablyInRange(const llvm::BranchInst *branch, bool panicsOnTrue,
+                                            llvm::ScalarEvolution &scalarEvolution) {
+  const auto *cmp = llvm::cast<llvm::ICmpInst>(branch->getCondition());
+  llvm::Value *lhs = cmp->getOperand(0);
+  llvm::Value *rhs = cmp->getOperand(1);
+  if (!lhs->getType()->isIntegerTy() || !scalarEvolution.isSCEVable(lhs->getType()))
+    return false;
+
+  // The predicate, that has to hold to not panic
+  const llvm::ICmpInst::Predicate safePred = panicsOnTrue ? cmp->getInversePredicate() : cmp->getPredicate();
+  const llvm::SCEV *lhsSCEV = scalarEvolution.getSCEV(lhs);
+  const llvm::SCEV *rhsSCEV = scalarEvolution.getSCEV(rhs);
+  return scalarEvolution.isKnownPredicateAt(safePred, lhsSCEV, rhsSCEV, branch);
+}
+
+} // namespace spice::compiler
@@ -0,0 +1,33 @@
+// Copyright (c) 2021-2025 ChilliBits. All rights reserved.
+
+#pragma once
+
+#include <llvm/IR/PassManager.h>
+
+// Forward declarations
+namespace llvm {
+class BasicBlock;
+class BranchInst;
+class ScalarEvolution;
+} // namespace llvm
+
+namespace spice::compiler {
+
+/**
+ * Removes index checks, that guard a panic, if the checked index is provably in range. This typically applies to
+ * loops over arrays or vectors, where the induction variable is bounded by the loop guard and the inlined index
+ * check of e.g. Vector.get() is therefore redundant. The proof is done via scalar evolution, which also takes
+ * dominating loop guards and conditions into account.
+ */
+class BoundsCheckElimPass : public llvm::PassInfoMixin<BoundsCheckElimPass> {
+public:
+  // Public methods
+  llvm::PreservedAnalyses run(llvm::Function &function, llvm::FunctionAnalysisManager &functionAnalysisMgr);
+
+private:
+  // Private methods
+  static bool isPanicBlock(const llvm::BasicBlock *block);
+  static bool isProvablyInRange(const llvm::BranchInst *branch, bool panicsOnTrue, llvm::ScalarEvolution &scalarEvolution);
+};
+
+} // namespace spice::compiler
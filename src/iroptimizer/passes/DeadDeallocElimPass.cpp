@@ -0,0 +1,66 @@
+// Copyright (c) 2021-2025 ChilliBits. All rights reserved.
+
+#include "DeadDeallocElimPass.h"
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Instructions.h>
+
+namespace spice::compiler {
+
+static constexpr const char *const FCT_NAME_DEALLOC = "_Z8sDeallocRPh";
+
+llvm::PreservedAnalyses DeadDeallocElimPass::run(llvm::Function &function, llvm::FunctionAnalysisManager &) {
+  // Collect all dead dealloc calls
+  std::vector<llvm::CallInst *> deadCalls;
+  for (llvm::BasicBlock &block : function)
+    for (llvm::Instruction &inst : block)
+      if (isDeallocCall(&inst) && isNilAtCall(llvm::cast<llvm::CallInst>(&inst)))
+        deadCalls.push_back(llvm::cast<llvm::CallInst>(&inst));
+
+  if (deadCalls.empty())
+    return llvm::PreservedAnalyses::all();
+
+  // Remove them
+  for (llvm::CallInst *deadCall : deadCalls)
+    deadCall->eraseFromParent();
+
+  llvm::PreservedAnalyses preservedAnalyses;
+  preservedAnalyses.preserveSet<llvm::CFGAnalyses>();
+  return preservedAnalyses;
+}
+
+bool DeadDeallocElimPass::isDeallocCall(const llvm::Instruction *inst) {
+  const auto *call = llvm::dyn_cast<llvm::CallInst>(inst);
+  if (!call || call->arg_size() != 1)
+    return false;
+  const llvm::Function *callee = call->getCalledFunction();
+  return callee && callee->getName() == FCT_NAME_DEALLOC;
+}
+
+/**
+ * Check if the pointer slot, passed to the given dealloc call, is guaranteed to contain nil at the time of the call.
+ * This is the case if the last write to the slot in the same block stores nil or is a dealloc call itself and no other
+ * instruction in between may write to memory.
+ *
+ * @param deallocCall Dealloc call
+ * @return Nil at call or not
+ */
+bool DeadDeallocElimPass::isNilAtCall(const llvm::CallInst *deallocCall) {
+  const llvm::Value *slot = deallocCall->getArgOperand(0)->stripPointerCasts();
+  for (const llvm::Instruction *inst = deallocCall->getPrevNode(); inst != nullptr; inst = inst->getPrevNode()) {
+    // Check for a store to the slot
+    if (const auto *store = llvm::dyn_cast<llvm::StoreInst>(inst)) {
+      if (store->getPointerOperand()->stripPointerCasts() == slot)
+        return llvm::isa<llvm::ConstantPointerNull>(store->getValueOperand());
+    }
+    // Check for a previous dealloc call on the same slot, which zeroed out the pointer
+    if (isDeallocCall(inst) && llvm::cast<llvm::CallInst>(inst)->getArgOperand(0)->stripPointerCasts() == slot)
+      return true;
+    // Give up if anything else could have written to the slot
+    if (inst->mayWriteToMemory())
+      return false;
+  }
+  return false;
+}
+
+} // namespace spice::compiler
@@ -0,0 +1,24 @@
+// Copyright (c) 2021-2025 ChilliBits. All rights reserved.
+
+#pragma once
+
+#include <llvm/IR/PassManager.h>
+
+namespace spice::compiler {
+
+/**
+ * Removes calls to sDealloc() from the memory runtime, that are known to operate on a nil pointer.
+ * sDealloc() zeroes out the pointer after freeing it, so a subsequent dealloc call on the same slot is dead as well.
+ */
+class DeadDeallocElimPass : public llvm::PassInfoMixin<DeadDeallocElimPass> {
+public:
+  // Public methods
+  llvm::PreservedAnalyses run(llvm::Function &function, llvm::FunctionAnalysisManager &functionAnalysisMgr);
+
+private:
+  // Private methods
+  static bool isDeallocCall(const llvm::Instruction *inst);
+  static bool isNilAtCall(const llvm::CallInst *deallocCall);
+};
+
+} // namespace spice::compiler
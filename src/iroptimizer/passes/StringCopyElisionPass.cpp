@@ -0,0 +1,136 @@
+// Copyright (c) 2021-2025 ChilliBits. All rights reserved.
+
+#include "StringCopyElisionPass.h"
+
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/IntrinsicInst.h>
+#include <llvm/IR/Module.h>
+
+namespace spice::compiler {
+
+static constexpr const char *const STRUCT_NAME_STRING = "struct.String";
+static constexpr const char *const FCT_NAME_STRING_CTOR_PREFIX = "_ZN6String4ctor";
+static constexpr const char *const FCT_NAME_STRING_COPY_CTOR = "_ZN6String4ctorERK6String";
+static constexpr const char *const FCT_NAME_STRING_DTOR = "_ZN6String4dtorEv";
+
+llvm::PreservedAnalyses StringCopyElisionPass::run(llvm::Function &function, llvm::FunctionAnalysisManager &) {
+  // Collect all copy ctor calls, that can be elided
+  std::vector<std::pair<llvm::CallInst *, llvm::CallInst *>> elidableCopies;
+  for (llvm::BasicBlock &block : function)
+    for (llvm::Instruction &inst : block)
+      if (isCallTo(&inst, FCT_NAME_STRING_COPY_CTOR))
+        if (llvm::CallInst *srcDtorCall = getElidableSourceDtor(llvm::cast<llvm::CallInst>(&inst)))
+          elidableCopies.emplace_back(llvm::cast<llvm::CallInst>(&inst), srcDtorCall);
+
+  if (elidableCopies.empty())
+    return llvm::PreservedAnalyses::all();
+
+  // Replace the deep copies with shallow copies and remove the dtor calls of the sources
+  const llvm::DataLayout &dataLayout = function.getParent()->getDataLayout();
+  for (const auto &[copyCtorCall, srcDtorCall] : elidableCopies) {
+    auto *srcAlloca = llvm::cast<llvm::AllocaInst>(copyCtorCall->getArgOperand(1)->stripPointerCasts());
+    llvm::Type *stringType = srcAlloca->getAllocatedType();
+    llvm::Value *dstPtr = copyCtorCall->getArgOperand(0);
+
+    llvm::IRBuilder<> builder(copyCtorCall);
+    const llvm::Align dstAlign = dataLayout.getABITypeAlign(stringType);
+    builder.CreateMemCpy(dstPtr, dstAlign, srcAlloca, srcAlloca->getAlign(), dataLayout.getTypeAllocSize(stringType));
+
+    copyCtorCall->eraseFromParent();
+    srcDtorCall->eraseFromParent();
+  }
+
+  llvm::PreservedAnalyses preservedAnalyses;
+  preservedAnalyses.preserveSet<llvm::CFGAnalyses>();
+  return preservedAnalyses;
+}
+
+/**
+ * Check if the source of the given copy ctor call is a String temporary, that is not used anymore after the copy, except
+ * for its dtor call. To stay conservative, all other users of the source have to be located in front of the copy in the
+ * same block and are not allowed to let the pointer to the source or its heap buffer escape. The source may be
+ * initialized by a store, a String ctor call or a call, that returns the String via the source as sret pointer.
+ *
+ * @param copyCtorCall Copy ctor call
+ * @return Dtor call of the source if the copy can be elided, nullptr otherwise
+ */
+llvm::CallInst *StringCopyElisionPass::getElidableSourceDtor(const llvm::CallInst *copyCtorCall) {
+  assert(copyCtorCall->arg_size() == 2);
+  const llvm::Value *dstPtr = copyCtorCall->getArgOperand(0)->stripPointerCasts();
+  const auto *srcAlloca = llvm::dyn_cast<llvm::AllocaInst>(copyCtorCall->getArgOperand(1)->stripPointerCasts());
+  if (!srcAlloca || srcAlloca == dstPtr)
+    return nullptr;
+
+  // Make sure that we actually deal with a String
+  const auto *structType = llvm::dyn_cast<llvm::StructType>(srcAlloca->getAllocatedType());
+  if (!structType || !structType->hasName() || structType->getName() != STRUCT_NAME_STRING)
+    return nullptr;
+
+  const llvm::BasicBlock *block = copyCtorCall->getParent();
+  llvm::CallInst *srcDtorCall = nullptr;
+  for (const llvm::User *user : srcAlloca->users()) {
+    const auto *userInst = llvm::dyn_cast<llvm::Instruction>(user);
+    // Lifetime markers do not access the contents of the source
+    if (llvm::isa_and_nonnull<llvm::LifetimeIntrinsic>(userInst))
+      continue;
+    if (!userInst || userInst->getParent() != block)
+      return nullptr;
+    if (userInst == copyCtorCall)
+      continue;
+
+    // Check for the dtor call of the source
+    if (isCallTo(userInst, FCT_NAME_STRING_DTOR)) {
+      if (srcDtorCall != nullptr || !copyCtorCall->comesBefore(userInst))
+        return nullptr;
+      srcDtorCall = llvm::cast<llvm::CallInst>(const_cast<llvm::Instruction *>(userInst));
+      continue;
+    }
+
+    // All other users have to initialize the source before the copy
+    if (!userInst->comesBefore(copyCtorCall))
+      return nullptr;
+    const auto *store = llvm::dyn_cast<llvm::StoreInst>(userInst);
+    const bool isInitializingStore = store && store->getPointerOperand() == srcAlloca && store->getValueOperand() != srcAlloca;
+    if (!isInitializingStore && !isCallToStringCtor(userInst, srcAlloca) && !isSRetCallWithResult(userInst, srcAlloca))
+      return nullptr;
+  }
+  return srcDtorCall;
+}
+
+bool StringCopyElisionPass::isCallTo(const llvm::Instruction *inst, const char *fctName) {
+  const auto *call = llvm::dyn_cast<llvm::CallInst>(inst);
+  if (!call)
+    return false;
+  const llvm::Function *callee = call->getCalledFunction();
+  return callee && callee->getName() == fctName;
+}
+
+bool StringCopyElisionPass::isCallToStringCtor(const llvm::Instruction *inst, const llvm::Value *thisPtr) {
+  const auto *call = llvm::dyn_cast<llvm::CallInst>(inst);
+  if (!call)
+    return false;
+  const llvm::Function *callee = call->getCalledFunction();
+  if (!callee || !callee->getName().starts_with(FCT_NAME_STRING_CTOR_PREFIX))
+    return false;
+  // The this pointer must not be passed as any other argument than the first one
+  return isOnlyFirstArg(call, thisPtr);
+}
+
+bool StringCopyElisionPass::isSRetCallWithResult(const llvm::Instruction *inst, const llvm::Value *resultPtr) {
+  const auto *call = llvm::dyn_cast<llvm::CallInst>(inst);
+  if (!call || call->arg_size() == 0 || !call->paramHasAttr(0, llvm::Attribute::StructRet))
+    return false;
+  // The result pointer must not be passed as any other argument than the sret one
+  return isOnlyFirstArg(call, resultPtr);
+}
+
+bool StringCopyElisionPass::isOnlyFirstArg(const llvm::CallInst *call, const llvm::Value *ptr) {
+  for (unsigned int i = 0; i < call->arg_size(); i++)
+    if ((call->getArgOperand(i)->stripPointerCasts() == ptr) != (i == 0))
+      return false;
+  return true;
+}
+
+} // namespace spice::compiler
@@ -0,0 +1,34 @@
+// Copyright (c) 2021-2025 ChilliBits. All rights reserved.
+
+#pragma once
+
+#include <llvm/IR/PassManager.h>
+
+// Forward declarations
+namespace llvm {
+class CallInst;
+} // namespace llvm
+
+namespace spice::compiler {
+
+/**
+ * Elides String copy ctor calls, where the source String is a temporary, that only gets destructed after the copy.
+ * This covers Strings created by a ctor call as well as Strings returned from functions via sret pointer.
+ * In this case, the ownership of the heap buffer can be transferred to the copy by a shallow copy and the dtor call of the
+ * source can be removed. This saves one malloc/free pair and one memcpy of the string contents.
+ */
+class StringCopyElisionPass : public llvm::PassInfoMixin<StringCopyElisionPass> {
+public:
+  // Public methods
+  llvm::PreservedAnalyses run(llvm::Function &function, llvm::FunctionAnalysisManager &functionAnalysisMgr);
+
+private:
+  // Private methods
+  static llvm::CallInst *getElidableSourceDtor(const llvm::CallInst *copyCtorCall);
+  static bool isCallTo(const llvm::Instruction *inst, const char *fctName);
+  static bool isCallToStringCtor(const llvm::Instruction *inst, const llvm::Value *thisPtr);
+  static bool isSRetCallWithResult(const llvm::Instruction *inst, const llvm::Value *resultPtr);
+  static bool isOnlyFirstArg(const llvm::CallInst *call, const llvm::Value *ptr);
+};
+
+} // namespace spice::compiler
@@ -12,6 +12,8 @@
 namespace spice::compiler {
 
 void ExternalLinkerInterface::prepare() {
+  linkerInvoker = FileUtil::findLinkerInvoker();
+
   // Set target to linker
   addLinkerFlag("--target=" + cliOptions.targetTriple);
 
@@ -19,6 +21,13 @@ void ExternalLinkerInterface::prepare() {
   if (cliOptions.staticLinking)
     addLinkerFlag("-static");
 
+  // Link the profile runtime for instrumented executables. Only clang ships the LLVM profile runtime, gcc would link gcov
+  if (cliOptions.pgoInstrGen) {
+    if (std::string(linkerInvoker.name) != "clang")                                                         // GCOV_EXCL_LINE
+      throw LinkerError(LINKER_ERROR, "Linking instrumented executables requires clang as linker invoker"); // GCOV_EXCL_LINE
+    addLinkerFlag("-fprofile-generate");
+  }
+
   // Stripping symbols
   if (!cliOptions.generateDebugInfo)
     addLinkerFlag("-Wl,-s");
@@ -36,10 +45,11 @@ void ExternalLinkerInterface::prepare() {
  */
 void ExternalLinkerInterface::link() const {
   assert(!outputPath.empty());
+  assert(linkerInvoker.name != nullptr); // prepare() has to be called first
 
   // Build the linker command
   std::stringstream linkerCommandBuilder;
-  const auto [linkerInvokerName, linkerInvokerPath] = FileUtil::findLinkerInvoker();
+  const auto &[linkerInvokerName, linkerInvokerPath] = linkerInvoker;
   linkerCommandBuilder << linkerInvokerPath;
   const auto [linkerName, linkerPath] = FileUtil::findLinker(cliOptions);
   linkerCommandBuilder << " -fuse-ld=" << linkerPath;
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include <driver/Driver.h>
+#include <util/FileUtil.h>
 
 namespace spice::compiler {
 
@@ -28,6 +29,7 @@ public:
 private:
   // Members
   const CliOptions &cliOptions;
+  ExternalBinaryFinderResult linkerInvoker = {};
   std::vector<std::string> objectFilePaths;
   std::vector<std::string> linkerFlags = {
       // "-flto", // Enable LTO
@@ -81,6 +81,7 @@ public:
   bool used = false;
   bool implicitDefault = false;
   bool isVirtual = false;
+  bool isCompileTime = false;
   llvm::Function *llvmFunction = nullptr;
   size_t vtableIndex = 0;
 };
@@ -7,7 +7,18 @@
 #include <util/RawStringOStream.h>
 
 #include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IR/Module.h>
+#include <llvm/MC/MCAsmBackend.h>
+#include <llvm/MC/MCCodeEmitter.h>
+#include <llvm/MC/MCContext.h>
+#include <llvm/MC/MCObjectFileInfo.h>
+#include <llvm/MC/MCObjectWriter.h>
+#include <llvm/MC/MCParser/MCAsmParser.h>
+#include <llvm/MC/MCParser/MCTargetAsmParser.h>
+#include <llvm/MC/MCStreamer.h>
+#include <llvm/MC/TargetRegistry.h>
 #include <llvm/Support/FileSystem.h>
+#include <llvm/Support/SourceMgr.h>
 
 namespace spice::compiler {
 
@@ -15,7 +26,15 @@ ObjectEmitter::ObjectEmitter(GlobalResourceManager &resourceManager, SourceFile
     : CompilerPass(resourceManager, sourceFile),
       module(cliOptions.useLTO ? *resourceManager.ltoModule : *sourceFile->llvmModule) {}
 
-void ObjectEmitter::emit(const std::filesystem::path &objectPath) const {
+/**
+ * Emit the object file for the module of this source file.
+ * If an assembly output string is passed, the backend pipeline emits assembly code once, which then gets assembled into the
+ * object file by the integrated assembler. This way we avoid running the expensive codegen pipeline twice.
+ *
+ * @param objectPath Path of the object file to emit
+ * @param asmOutput Optional output string for the assembly code
+ */
+void ObjectEmitter::emit(const std::filesystem::path &objectPath, std::string *asmOutput) const {
   const std::string objectPathString = objectPath.string();
 
   // Open file output stream
@@ -24,26 +43,75 @@ void ObjectEmitter::emit(const std::filesystem::path &objectPath) const {
   if (errorCode)
     throw CompilerError(CANT_OPEN_OUTPUT_FILE, "File '" + objectPathString + "' could not be opened"); // GCOV_EXCL_LINE
 
-  llvm::legacy::PassManager passManager;
-  constexpr auto fileType = llvm::CodeGenFileType::ObjectFile;
-  if (sourceFile->targetMachine->addPassesToEmitFile(passManager, stream, nullptr, fileType, cliOptions.disableVerifier))
-    throw CompilerError(WRONG_OUTPUT_TYPE, "Target machine can't emit a file of this type"); // GCOV_EXCL_LINE
+  if (asmOutput != nullptr) {
+    // Run codegen pipeline once to get the assembly code and assemble it to the object file afterward
+    emitASM(*asmOutput);
+    assemble(*asmOutput, stream);
+  } else {
+    // Run codegen pipeline to directly emit the object file
+    llvm::legacy::PassManager passManager;
+    constexpr auto fileType = llvm::CodeGenFileType::ObjectFile;
+    if (sourceFile->targetMachine->addPassesToEmitFile(passManager, stream, nullptr, fileType, cliOptions.disableVerifier))
+      throw CompilerError(WRONG_OUTPUT_TYPE, "Target machine can't emit a file of this type"); // GCOV_EXCL_LINE
 
-  // Emit object file
-  passManager.run(module);
+    // Emit object file
+    passManager.run(module);
+  }
   stream.flush();
 }
 
-void ObjectEmitter::getASMString(std::string &output) const {
+void ObjectEmitter::emitASM(std::string &output) const {
   RawStringOStream ostream(output);
   llvm::legacy::PassManager passManager;
   constexpr auto fileType = llvm::CodeGenFileType::AssemblyFile;
   if (sourceFile->targetMachine->addPassesToEmitFile(passManager, ostream, nullptr, fileType, cliOptions.disableVerifier))
     throw CompilerError(WRONG_OUTPUT_TYPE, "Target machine can't emit a file of this type"); // GCOV_EXCL_LINE
 
-  // Emit object file
+  // Emit assembly code
   passManager.run(module);
   ostream.flush();
 }
 
-} // namespace spice::compiler
\ No newline at end of file
+void ObjectEmitter::assemble(const std::string &asmString, llvm::raw_pwrite_stream &objectStream) const {
+  const llvm::TargetMachine &targetMachine = *sourceFile->targetMachine;
+  const llvm::Target &target = targetMachine.getTarget();
+  const llvm::Triple &triple = targetMachine.getTargetTriple();
+  const llvm::MCTargetOptions &mcOptions = targetMachine.Options.MCOptions;
+  const llvm::MCRegisterInfo &mri = *targetMachine.getMCRegisterInfo();
+  const llvm::MCAsmInfo &mai = *targetMachine.getMCAsmInfo();
+  const llvm::MCSubtargetInfo &sti = *targetMachine.getMCSubtargetInfo();
+  const llvm::MCInstrInfo &mii = *targetMachine.getMCInstrInfo();
+
+  // Load the assembly code into a source manager
+  llvm::SourceMgr srcMgr;
+  srcMgr.AddNewSourceBuffer(llvm::MemoryBuffer::getMemBuffer(asmString, sourceFile->fileName), llvm::SMLoc());
+
+  // Set up the MC layer
+  llvm::MCContext mcContext(triple, &mai, &mri, &sti, &srcMgr, &mcOptions);
+  const bool isPIC = targetMachine.isPositionIndependent();
+  const bool isLargeCodeModel = targetMachine.getCodeModel() == llvm::CodeModel::Large;
+  const std::unique_ptr<llvm::MCObjectFileInfo> mofi(target.createMCObjectFileInfo(mcContext, isPIC, isLargeCodeModel));
+  mcContext.setObjectFileInfo(mofi.get());
+  if (const unsigned dwarfVersion = module.getDwarfVersion(); dwarfVersion > 0)
+    mcContext.setDwarfVersion(dwarfVersion);
+
+  // Create object streamer
+  std::unique_ptr<llvm::MCAsmBackend> asmBackend(target.createMCAsmBackend(sti, mri, mcOptions));
+  std::unique_ptr<llvm::MCCodeEmitter> codeEmitter(target.createMCCodeEmitter(mii, mcContext));
+  if (!asmBackend || !codeEmitter)
+    throw CompilerError(WRONG_OUTPUT_TYPE, "Target machine can't emit a file of this type"); // GCOV_EXCL_LINE
+  std::unique_ptr<llvm::MCObjectWriter> objectWriter = asmBackend->createObjectWriter(objectStream);
+  const std::unique_ptr<llvm::MCStreamer> streamer(target.createMCObjectStreamer(
+      triple, mcContext, std::move(asmBackend), std::move(objectWriter), std::move(codeEmitter), sti));
+
+  // Parse the assembly code and stream it into the object file
+  const std::unique_ptr<llvm::MCAsmParser> parser(llvm::createMCAsmParser(srcMgr, mcContext, *streamer, mai));
+  const std::unique_ptr<llvm::MCTargetAsmParser> targetParser(target.createMCAsmParser(sti, *parser, mii, mcOptions));
+  if (!targetParser)
+    throw CompilerError(WRONG_OUTPUT_TYPE, "Target machine has no assembly parser"); // GCOV_EXCL_LINE
+  parser->setTargetParser(*targetParser);
+  if (parser->Run(false))
+    throw CompilerError(INTERNAL_ERROR, "Could not assemble the generated assembly code"); // GCOV_EXCL_LINE
+}
+
+} // namespace spice::compiler
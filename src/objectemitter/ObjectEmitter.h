@@ -16,12 +16,15 @@ public:
   ObjectEmitter(GlobalResourceManager &resourceManager, SourceFile *sourceFile);
 
   // Public methods
-  void emit(const std::filesystem::path &objectPath) const;
-  void getASMString(std::string &output) const;
+  void emit(const std::filesystem::path &objectPath, std::string *asmOutput = nullptr) const;
 
 private:
   // Private members
   llvm::Module &module;
+
+  // Private methods
+  void emitASM(std::string &output) const;
+  void assemble(const std::string &asmString, llvm::raw_pwrite_stream &objectStream) const;
 };
 
-} // namespace spice::compiler
\ No newline at end of file
+} // namespace spice::compiler
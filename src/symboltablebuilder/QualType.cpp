@@ -199,6 +199,16 @@ bool QualType::isArray() const { return type->isArray(); }
  */
 bool QualType::isArrayOf(SuperType superType) const { return isArray() && getContained().is(superType); }
 
+/**
+ * Check if the underlying type is a fixed-size array of a numeric type, that can be lowered to a SIMD vector
+ *
+ * @return SIMD vector or not
+ */
+bool QualType::isSimdVector() const {
+  return isArray() && getArraySize() != ARRAY_SIZE_UNKNOWN &&
+         getContained().isOneOf({TY_DOUBLE, TY_INT, TY_SHORT, TY_LONG, TY_BYTE, TY_CHAR});
+}
+
 /**
  * Check if the underlying type is a const reference
  *
@@ -25,6 +25,7 @@ enum SuperType : uint8_t;
 
 // Constants
 const char *const STROBJ_NAME = "String";
+const char *const STRVIEWOBJ_NAME = "StringView";
 const char *const RESULTOBJ_NAME = "Result";
 const char *const ERROBJ_NAME = "Error";
 const char *const TIOBJ_NAME = "TypeInfo";
@@ -72,6 +73,7 @@ public:
   [[nodiscard]] bool isRefTo(SuperType superType) const;
   [[nodiscard]] bool isArray() const;
   [[nodiscard]] bool isArrayOf(SuperType superType) const;
+  [[nodiscard]] bool isSimdVector() const;
   [[nodiscard]] bool isConstRef() const;
   [[nodiscard]] bool isIterator(const ASTNode *node) const;
   [[nodiscard]] bool isIterable(const ASTNode *node) const;
@@ -19,6 +19,8 @@ ScopeHandle::ScopeHandle(CompilerPass *pass, const std::string &childScopeId, co
 
 ScopeHandle::ScopeHandle(IRGenerator *generator, Scope *childScope, const ScopeType &scopeType, const ASTNode *node)
     : DeferredLogic([=]() {
+        // End the lifetimes of variables, that were declared in the head of the control structure
+        generator->generateLifetimeEndMarkers(node->getNextOuterStmtLst());
         generator->changeToParentScope(scopeType);
         generator->diGenerator.popLexicalBlock();
       }) {
@@ -0,0 +1,775 @@
+// Copyright (c) 2021-2025 ChilliBits. All rights reserved.
+
+#include "CompileTimeEvaluator.h"
+
+#include <cmath>
+
+#include <exception/CompilerError.h>
+#include <exception/SemanticError.h>
+#include <model/Function.h>
+#include <symboltablebuilder/Scope.h>
+#include <symboltablebuilder/SymbolTableBuilder.h>
+#include <symboltablebuilder/SymbolTableEntry.h>
+
+namespace spice::compiler {
+
+static constexpr size_t MAX_EVALUATION_STEPS = 10'000'000;
+static constexpr size_t MAX_CALL_DEPTH = 256;
+
+/**
+ * Evaluate the given call to a compile-time function
+ *
+ * @param node Function call node
+ * @param targetType Type of the value, that is expected by the caller
+ * @return Result of the call in the layout, that is expected for constants of the target type
+ */
+CompileTimeValue CompileTimeEvaluator::evaluateCall(const FctCallNode *node, const QualType &targetType) {
+  assert(frames.empty());
+  // Evaluate the call in an empty frame, so that only constant arguments are accepted
+  frames.emplace_back();
+  const CompileTimeValue result = call(node);
+  frames.pop_back();
+  return toStorageLayout(convert(result, getType(node), targetType), targetType);
+}
+
+/**
+ * Check if values of the given type can be handled by the compile-time evaluator
+ *
+ * @param qualType Type to check
+ * @return Supported or not
+ */
+bool CompileTimeEvaluator::isSupportedType(const QualType &qualType) {
+  return qualType.isOneOf({TY_DOUBLE, TY_INT, TY_SHORT, TY_LONG, TY_BYTE, TY_CHAR, TY_BOOL});
+}
+
+CompileTimeValue CompileTimeEvaluator::call(const FctCallNode *node) { // NOLINT(misc-no-recursion)
+  const FctCallNode::FctCallData &data = node->data.front();
+  const Function *callee = data.callee;
+  if (!data.isOrdinaryCall() || !callee || !callee->isCompileTime)
+    throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED,
+                        "Only functions with the core.compiler.compileTime attribute can be called at compile time");
+  if (frames.size() > MAX_CALL_DEPTH)
+    throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "Maximum call depth exceeded during compile-time evaluation");
+  assert(callee->alreadyTypeChecked);
+  const auto fctDefNode = spice_pointer_cast<const FctDefNode *>(callee->declNode);
+
+  // Evaluate the arguments in the frame of the caller
+  std::vector<CompileTimeValue> args;
+  if (node->hasArgs) {
+    args.reserve(node->argLst->args.size());
+    for (size_t i = 0; i < node->argLst->args.size(); i++) {
+      const AssignExprNode *arg = node->argLst->args.at(i);
+      args.push_back(convert(evaluate(arg), getType(arg), callee->paramList.at(i).qualType));
+    }
+  }
+
+  // Set up the frame of the callee
+  Frame frame;
+  frame.function = callee;
+  frame.resultEntry = callee->bodyScope->lookupStrict(RETURN_VARIABLE_NAME);
+  assert(frame.resultEntry != nullptr);
+  frame.variables[frame.resultEntry] = CompileTimeValue{};
+  frames.push_back(std::move(frame));
+
+  // Bind the arguments to the parameters. Missing arguments are filled with the default values of optional parameters
+  if (fctDefNode->hasParams) {
+    const std::vector<DeclStmtNode *> &params = fctDefNode->paramLst->params;
+    for (size_t i = 0; i < params.size(); i++) {
+      const DeclStmtNode *param = params.at(i);
+      const SymbolTableEntry *paramEntry = param->entries.front();
+      if (i < args.size())
+        store(paramEntry, args.at(i));
+      else
+        store(paramEntry, convert(evaluate(param->assignExpr), getType(param->assignExpr), paramEntry->getQualType()));
+    }
+  }
+
+  // Execute the function body
+  const ControlFlow controlFlow = execute(fctDefNode->body);
+  const Frame &calleeFrame = frames.back();
+  const CompileTimeValue result =
+      controlFlow == ControlFlow::RETURN ? calleeFrame.returnValue : calleeFrame.variables.at(calleeFrame.resultEntry);
+  frames.pop_back();
+  return result;
+}
+
+CompileTimeEvaluator::ControlFlow CompileTimeEvaluator::execute(const StmtLstNode *node) { // NOLINT(misc-no-recursion)
+  for (const StmtNode *stmt : node->statements) {
+    if (!stmt || stmt->unreachable)
+      continue;
+    if (const ControlFlow controlFlow = executeStmt(stmt); controlFlow != ControlFlow::NONE)
+      return controlFlow;
+  }
+  return ControlFlow::NONE;
+}
+
+CompileTimeEvaluator::ControlFlow CompileTimeEvaluator::executeStmt(const StmtNode *node) { // NOLINT(misc-no-recursion)
+  countStep(node);
+  return std::any_cast<ControlFlow>(visit(node));
+}
+
+/**
+ * Execute the body of a loop and resolve break and continue statements, that target this loop
+ *
+ * @param body Loop body
+ * @param exitLoop Set to true, if the loop has to be left
+ * @return Control flow, that has to be propagated to the enclosing statements
+ */
+CompileTimeEvaluator::ControlFlow CompileTimeEvaluator::executeLoopBody(const StmtLstNode *body, bool &exitLoop) {
+  const ControlFlow controlFlow = execute(body);
+  if (controlFlow == ControlFlow::RETURN)
+    return controlFlow;
+  if (controlFlow == ControlFlow::BREAK || controlFlow == ControlFlow::CONTINUE) {
+    // Break or continue an outer loop
+    if (--frames.back().pendingLoopExits > 0) {
+      exitLoop = true;
+      return controlFlow;
+    }
+    exitLoop = controlFlow == ControlFlow::BREAK;
+  }
+  return ControlFlow::NONE;
+}
+
+CompileTimeValue CompileTimeEvaluator::evaluate(const ASTNode *node) { // NOLINT(misc-no-recursion)
+  const std::any result = visit(node);
+  if (result.type() != typeid(CompileTimeValue))
+    throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "This expression is not supported in compile-time functions");
+  return std::any_cast<CompileTimeValue>(result);
+}
+
+std::any CompileTimeEvaluator::visitUnsafeBlockDef(const UnsafeBlockNode *node) { return execute(node->body); }
+
+std::any CompileTimeEvaluator::visitForLoop(const ForLoopNode *node) { // NOLINT(misc-no-recursion)
+  (void)executeStmt(node->initDecl);
+  bool exitLoop = false;
+  while (!exitLoop && evaluateCondition(node->condAssign)) {
+    countStep(node);
+    if (const ControlFlow controlFlow = executeLoopBody(node->body, exitLoop); controlFlow != ControlFlow::NONE)
+      return controlFlow;
+    if (!exitLoop)
+      (void)evaluate(node->incAssign);
+  }
+  return ControlFlow::NONE;
+}
+
+std::any CompileTimeEvaluator::visitForeachLoop(const ForeachLoopNode *node) {
+  throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "Foreach loops are not supported in compile-time functions");
+}
+
+std::any CompileTimeEvaluator::visitWhileLoop(const WhileLoopNode *node) { // NOLINT(misc-no-recursion)
+  bool exitLoop = false;
+  while (!exitLoop && evaluateCondition(node->condition)) {
+    countStep(node);
+    if (const ControlFlow controlFlow = executeLoopBody(node->body, exitLoop); controlFlow != ControlFlow::NONE)
+      return controlFlow;
+  }
+  return ControlFlow::NONE;
+}
+
+std::any CompileTimeEvaluator::visitDoWhileLoop(const DoWhileLoopNode *node) { // NOLINT(misc-no-recursion)
+  bool exitLoop = false;
+  do {
+    countStep(node);
+    if (const ControlFlow controlFlow = executeLoopBody(node->body, exitLoop); controlFlow != ControlFlow::NONE)
+      return controlFlow;
+  } while (!exitLoop && evaluateCondition(node->condition));
+  return ControlFlow::NONE;
+}
+
+std::any CompileTimeEvaluator::visitIfStmt(const IfStmtNode *node) { // NOLINT(misc-no-recursion)
+  if (evaluateCondition(node->condition))
+    return execute(node->thenBody);
+  if (node->elseStmt)
+    return visit(node->elseStmt);
+  return ControlFlow::NONE;
+}
+
+std::any CompileTimeEvaluator::visitElseStmt(const ElseStmtNode *node) { // NOLINT(misc-no-recursion)
+  if (node->isElseIf)
+    return executeStmt(node->ifStmt);
+  return execute(node->body);
+}
+
+std::any CompileTimeEvaluator::visitSwitchStmt(const SwitchStmtNode *node) {
+  throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "Switch statements are not supported in compile-time functions");
+}
+
+std::any CompileTimeEvaluator::visitAnonymousBlockStmt(const AnonymousBlockStmtNode *node) { return execute(node->body); }
+
+std::any CompileTimeEvaluator::visitDeclStmt(const DeclStmtNode *node) { // NOLINT(misc-no-recursion)
+  const SymbolTableEntry *entry = node->entries.front();
+  const QualType &varType = entry->getQualType();
+  if (!isSupportedType(varType))
+    throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED,
+                        "Variables of type " + varType.getName(false) + " are not supported in compile-time functions");
+  CompileTimeValue value;
+  if (node->hasAssignment)
+    value = convert(evaluate(node->assignExpr), getType(node->assignExpr), varType);
+  store(entry, value);
+  return ControlFlow::NONE;
+}
+
+std::any CompileTimeEvaluator::visitExprStmt(const ExprStmtNode *node) { // NOLINT(misc-no-recursion)
+  (void)evaluate(node->expr);
+  return ControlFlow::NONE;
+}
+
+std::any CompileTimeEvaluator::visitReturnStmt(const ReturnStmtNode *node) { // NOLINT(misc-no-recursion)
+  const QualType &returnType = frames.back().function->returnType;
+  CompileTimeValue returnValue;
+  if (node->hasReturnValue)
+    returnValue = convert(evaluate(node->assignExpr), getType(node->assignExpr), returnType);
+  else
+    returnValue = frames.back().variables.at(frames.back().resultEntry);
+  frames.back().returnValue = returnValue;
+  return ControlFlow::RETURN;
+}
+
+std::any CompileTimeEvaluator::visitBreakStmt(const BreakStmtNode *node) {
+  frames.back().pendingLoopExits = node->breakTimes;
+  return ControlFlow::BREAK;
+}
+
+std::any CompileTimeEvaluator::visitContinueStmt(const ContinueStmtNode *node) {
+  frames.back().pendingLoopExits = node->continueTimes;
+  return ControlFlow::CONTINUE;
+}
+
+std::any CompileTimeEvaluator::visitFallthroughStmt(const FallthroughStmtNode *node) {
+  throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "Switch statements are not supported in compile-time functions");
+}
+
+std::any CompileTimeEvaluator::visitAssertStmt(const AssertStmtNode *node) { // NOLINT(misc-no-recursion)
+  if (!evaluateCondition(node->assignExpr))
+    throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "Assertion failed during compile-time evaluation");
+  return ControlFlow::NONE;
+}
+
+std::any CompileTimeEvaluator::visitAssignExpr(const AssignExprNode *node) { // NOLINT(misc-no-recursion)
+  if (node->ternaryExpr)
+    return evaluate(node->ternaryExpr);
+
+  const SymbolTableEntry *entry = getVariableEntry(node->lhs);
+  const QualType &lhsType = entry->getQualType();
+  const CompileTimeValue rhsValue = convert(evaluate(node->rhs), getType(node->rhs), lhsType);
+
+  CompileTimeValue newValue = rhsValue;
+  if (node->op != AssignExprNode::AssignOp::OP_ASSIGN)
+    newValue = applyArithmeticOp(node, getArithmeticOp(node->op), load(node->lhs, entry), rhsValue, lhsType);
+  store(entry, newValue);
+  return newValue;
+}
+
+std::any CompileTimeEvaluator::visitTernaryExpr(const TernaryExprNode *node) { // NOLINT(misc-no-recursion)
+  if (!node->falseExpr)
+    return evaluate(node->condition);
+
+  const QualType resultType = getType(node);
+  const CompileTimeValue condition = evaluate(node->condition);
+  if (condition.boolValue) {
+    if (node->isShortened)
+      return convert(condition, getType(node->condition), resultType);
+    return convert(evaluate(node->trueExpr), getType(node->trueExpr), resultType);
+  }
+  return convert(evaluate(node->falseExpr), getType(node->falseExpr), resultType);
+}
+
+std::any CompileTimeEvaluator::visitLogicalOrExpr(const LogicalOrExprNode *node) { // NOLINT(misc-no-recursion)
+  if (node->operands.size() == 1)
+    return evaluate(node->operands.front());
+  for (const LogicalAndExprNode *operand : node->operands)
+    if (evaluate(operand).boolValue)
+      return CompileTimeValue{.boolValue = true};
+  return CompileTimeValue{.boolValue = false};
+}
+
+std::any CompileTimeEvaluator::visitLogicalAndExpr(const LogicalAndExprNode *node) { // NOLINT(misc-no-recursion)
+  if (node->operands.size() == 1)
+    return evaluate(node->operands.front());
+  for (const BitwiseOrExprNode *operand : node->operands)
+    if (!evaluate(operand).boolValue)
+      return CompileTimeValue{.boolValue = false};
+  return CompileTimeValue{.boolValue = true};
+}
+
+std::any CompileTimeEvaluator::visitBitwiseOrExpr(const BitwiseOrExprNode *node) { // NOLINT(misc-no-recursion)
+  return evaluateOperatorChain(node, ArithmeticOp::OR);
+}
+
+std::any CompileTimeEvaluator::visitBitwiseXorExpr(const BitwiseXorExprNode *node) { // NOLINT(misc-no-recursion)
+  return evaluateOperatorChain(node, ArithmeticOp::XOR);
+}
+
+std::any CompileTimeEvaluator::visitBitwiseAndExpr(const BitwiseAndExprNode *node) { // NOLINT(misc-no-recursion)
+  return evaluateOperatorChain(node, ArithmeticOp::AND);
+}
+
+std::any CompileTimeEvaluator::visitEqualityExpr(const EqualityExprNode *node) { // NOLINT(misc-no-recursion)
+  if (node->operands.size() == 1)
+    return evaluate(node->operands.front());
+  const RelationalExprNode *lhs = node->operands.at(0);
+  const RelationalExprNode *rhs = node->operands.at(1);
+  const int result = compare(evaluate(lhs), getType(lhs), evaluate(rhs), getType(rhs));
+  const bool isEqual = result == 0;
+  return CompileTimeValue{.boolValue = node->op == EqualityExprNode::EqualityOp::OP_EQUAL ? isEqual : !isEqual};
+}
+
+std::any CompileTimeEvaluator::visitRelationalExpr(const RelationalExprNode *node) { // NOLINT(misc-no-recursion)
+  if (node->operands.size() == 1)
+    return evaluate(node->operands.front());
+  const ShiftExprNode *lhs = node->operands.at(0);
+  const ShiftExprNode *rhs = node->operands.at(1);
+  const int result = compare(evaluate(lhs), getType(lhs), evaluate(rhs), getType(rhs));
+  switch (node->op) {
+  case RelationalExprNode::RelationalOp::OP_LESS:
+    return CompileTimeValue{.boolValue = result < 0};
+  case RelationalExprNode::RelationalOp::OP_GREATER:
+    return CompileTimeValue{.boolValue = result > 0};
+  case RelationalExprNode::RelationalOp::OP_LESS_EQUAL:
+    return CompileTimeValue{.boolValue = result <= 0};
+  case RelationalExprNode::RelationalOp::OP_GREATER_EQUAL:
+    return CompileTimeValue{.boolValue = result >= 0};
+  default:                                                                                       // GCOV_EXCL_LINE
+    throw CompilerError(UNHANDLED_BRANCH, "CompileTimeEvaluator: RelationalExprNode fall-through"); // GCOV_EXCL_LINE
+  }
+}
+
+std::any CompileTimeEvaluator::visitShiftExpr(const ShiftExprNode *node) { return evaluateOpQueue(node); }
+
+std::any CompileTimeEvaluator::visitAdditiveExpr(const AdditiveExprNode *node) { return evaluateOpQueue(node); }
+
+std::any CompileTimeEvaluator::visitMultiplicativeExpr(const MultiplicativeExprNode *node) { return evaluateOpQueue(node); }
+
+std::any CompileTimeEvaluator::visitCastExpr(const CastExprNode *node) { // NOLINT(misc-no-recursion)
+  const CompileTimeValue value = evaluate(node->prefixUnaryExpr);
+  if (!node->isCast)
+    return value;
+  return convert(value, getType(node->prefixUnaryExpr), getType(node));
+}
+
+std::any CompileTimeEvaluator::visitPrefixUnaryExpr(const PrefixUnaryExprNode *node) { // NOLINT(misc-no-recursion)
+  if (node->postfixUnaryExpr)
+    return evaluate(node->postfixUnaryExpr);
+
+  const QualType operandType = getType(node->prefixUnaryExpr);
+  switch (node->op) {
+  case PrefixUnaryExprNode::PrefixUnaryOp::OP_MINUS: {
+    const CompileTimeValue value = evaluate(node->prefixUnaryExpr);
+    return applyArithmeticOp(node, ArithmeticOp::SUB, CompileTimeValue{}, value, operandType);
+  }
+  case PrefixUnaryExprNode::PrefixUnaryOp::OP_PLUS_PLUS: // fall-through
+  case PrefixUnaryExprNode::PrefixUnaryOp::OP_MINUS_MINUS: {
+    const SymbolTableEntry *entry = getVariableEntry(node->prefixUnaryExpr);
+    const QualType &varType = entry->getQualType();
+    const ArithmeticOp op = node->op == PrefixUnaryExprNode::PrefixUnaryOp::OP_PLUS_PLUS ? ArithmeticOp::ADD : ArithmeticOp::SUB;
+    const CompileTimeValue one = convert(CompileTimeValue{.longValue = 1}, QualType(TY_LONG), varType);
+    const CompileTimeValue newValue = applyArithmeticOp(node, op, load(node, entry), one, varType);
+    store(entry, newValue);
+    return newValue;
+  }
+  case PrefixUnaryExprNode::PrefixUnaryOp::OP_NOT:
+    return CompileTimeValue{.boolValue = !evaluate(node->prefixUnaryExpr).boolValue};
+  case PrefixUnaryExprNode::PrefixUnaryOp::OP_BITWISE_NOT: {
+    const CompileTimeValue value = evaluate(node->prefixUnaryExpr);
+    if (operandType.is(TY_BOOL))
+      return CompileTimeValue{.boolValue = !value.boolValue};
+    return CompileTimeValue{.longValue = normalize(~value.longValue, operandType)};
+  }
+  default:
+    throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "Pointer operations are not supported in compile-time functions");
+  }
+}
+
+std::any CompileTimeEvaluator::visitPostfixUnaryExpr(const PostfixUnaryExprNode *node) { // NOLINT(misc-no-recursion)
+  if (node->atomicExpr)
+    return evaluate(node->atomicExpr);
+
+  if (node->op != PostfixUnaryExprNode::PostfixUnaryOp::OP_PLUS_PLUS &&
+      node->op != PostfixUnaryExprNode::PostfixUnaryOp::OP_MINUS_MINUS)
+    throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED,
+                        "Subscript and member access are not supported in compile-time functions");
+
+  const SymbolTableEntry *entry = getVariableEntry(node->postfixUnaryExpr);
+  const QualType &varType = entry->getQualType();
+  const ArithmeticOp op = node->op == PostfixUnaryExprNode::PostfixUnaryOp::OP_PLUS_PLUS ? ArithmeticOp::ADD : ArithmeticOp::SUB;
+  const CompileTimeValue oldValue = load(node, entry);
+  const CompileTimeValue one = convert(CompileTimeValue{.longValue = 1}, QualType(TY_LONG), varType);
+  store(entry, applyArithmeticOp(node, op, oldValue, one, varType));
+  return oldValue;
+}
+
+std::any CompileTimeEvaluator::visitAtomicExpr(const AtomicExprNode *node) { // NOLINT(misc-no-recursion)
+  if (node->constant) {
+    if (node->constant->type == ConstantNode::PrimitiveValueType::TYPE_STRING)
+      throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "Strings are not supported in compile-time functions");
+    return fromStorageLayout(node->constant->getCompileTimeValue(), getType(node->constant));
+  }
+  if (node->assignExpr)
+    return evaluate(node->assignExpr);
+  if (node->value && node->value->fctCall)
+    return call(node->value->fctCall);
+  if (!node->fqIdentifier.empty())
+    return load(node, node->data.front().entry);
+  throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "This expression is not supported in compile-time functions");
+}
+
+/**
+ * Evaluate an expression, where all operands are connected with the same operator
+ */
+template <typename T>
+CompileTimeValue CompileTimeEvaluator::evaluateOperatorChain(const T *node, ArithmeticOp op) { // NOLINT(misc-no-recursion)
+  if (node->operands.size() == 1)
+    return evaluate(node->operands.front());
+
+  const QualType resultType = getType(node);
+  CompileTimeValue result = convert(evaluate(node->operands.front()), getType(node->operands.front()), resultType);
+  for (size_t i = 1; i < node->operands.size(); i++) {
+    const CompileTimeValue operand = convert(evaluate(node->operands.at(i)), getType(node->operands.at(i)), resultType);
+    result = applyArithmeticOp(node, op, result, operand, resultType);
+  }
+  return result;
+}
+
+/**
+ * Evaluate an expression, where the operands are connected with the operators from the op queue of the node.
+ * The op queue also contains the result type after applying each operator.
+ */
+template <typename T> CompileTimeValue CompileTimeEvaluator::evaluateOpQueue(const T *node) { // NOLINT(misc-no-recursion)
+  if (node->operands.size() == 1)
+    return evaluate(node->operands.front());
+
+  auto opQueue = node->opQueue;
+  QualType currentType = getType(node->operands.front());
+  CompileTimeValue result = evaluate(node->operands.front());
+  for (size_t i = 1; i < node->operands.size(); i++) {
+    const auto &[op, resultType] = opQueue.front();
+    const CompileTimeValue operand = convert(evaluate(node->operands.at(i)), getType(node->operands.at(i)), resultType);
+    result = applyArithmeticOp(node->operands.at(i), getArithmeticOp(op), convert(result, currentType, resultType), operand,
+                               resultType);
+    currentType = resultType;
+    opQueue.pop();
+  }
+  return result;
+}
+
+bool CompileTimeEvaluator::evaluateCondition(const AssignExprNode *node) { // NOLINT(misc-no-recursion)
+  return convert(evaluate(node), getType(node), QualType(TY_BOOL)).boolValue;
+}
+
+CompileTimeValue CompileTimeEvaluator::load(const ASTNode *node, const SymbolTableEntry *entry) {
+  assert(entry != nullptr);
+  const Frame &frame = frames.back();
+  if (const auto it = frame.variables.find(entry); it != frame.variables.end())
+    return it->second;
+
+  // Constant globals and enum items are known at compile time as well
+  const bool isConstGlobal = dynamic_cast<const GlobalVarDefNode *>(entry->declNode) && entry->getQualType().isConst();
+  const bool isEnumItem = dynamic_cast<const EnumItemNode *>(entry->declNode);
+  if ((isConstGlobal || isEnumItem) && entry->declNode->hasCompileTimeValue())
+    return fromStorageLayout(entry->declNode->getCompileTimeValue(), entry->getQualType());
+
+  throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "The value of '" + entry->name + "' is not known at compile time");
+}
+
+void CompileTimeEvaluator::store(const SymbolTableEntry *entry, const CompileTimeValue &value) {
+  frames.back().variables[entry] = value;
+}
+
+/**
+ * Retrieve the symbol table entry of a local variable, that is referenced by the given expression
+ *
+ * @param node Expression node
+ * @return Symbol table entry
+ */
+const SymbolTableEntry *CompileTimeEvaluator::getVariableEntry(const ASTNode *node) const {
+  const ASTNode *current = node;
+  while (current) {
+    if (const auto prefixUnaryExpr = dynamic_cast<const PrefixUnaryExprNode *>(current)) {
+      if (prefixUnaryExpr->op != PrefixUnaryExprNode::PrefixUnaryOp::OP_NONE)
+        break;
+      current = prefixUnaryExpr->postfixUnaryExpr;
+    } else if (const auto postfixUnaryExpr = dynamic_cast<const PostfixUnaryExprNode *>(current)) {
+      if (postfixUnaryExpr->op != PostfixUnaryExprNode::PostfixUnaryOp::OP_NONE)
+        break;
+      current = postfixUnaryExpr->atomicExpr;
+    } else if (const auto atomicExpr = dynamic_cast<const AtomicExprNode *>(current)) {
+      if (atomicExpr->fqIdentifier.empty())
+        break;
+      const SymbolTableEntry *entry = atomicExpr->data.front().entry;
+      if (!frames.back().variables.contains(entry))
+        break;
+      return entry;
+    } else {
+      break;
+    }
+  }
+  throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "Compile-time functions can only modify local variables");
+}
+
+void CompileTimeEvaluator::countStep(const ASTNode *node) {
+  if (++executedSteps > MAX_EVALUATION_STEPS)
+    throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "Compile-time evaluation exceeded the maximum number of steps");
+}
+
+QualType CompileTimeEvaluator::getType(const ASTNode *node) {
+  const auto exprNode = spice_pointer_cast<const ExprNode *>(node);
+  return exprNode->getEvaluatedSymbolType(0).removeReferenceWrapper();
+}
+
+/**
+ * Apply an arithmetic operator to two operands of the same type
+ *
+ * @param node Node for error reporting
+ * @param op Operator
+ * @param lhs Left operand
+ * @param rhs Right operand
+ * @param type Type of both operands and the result
+ * @return Result value
+ */
+CompileTimeValue CompileTimeEvaluator::applyArithmeticOp(const ASTNode *node, ArithmeticOp op, const CompileTimeValue &lhs,
+                                                         const CompileTimeValue &rhs, const QualType &type) {
+  if (!isSupportedType(type))
+    throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED,
+                        "Operands of type " + type.getName(false) + " are not supported in compile-time functions");
+
+  if (type.is(TY_DOUBLE)) {
+    switch (op) {
+    case ArithmeticOp::ADD:
+      return CompileTimeValue{.doubleValue = lhs.doubleValue + rhs.doubleValue};
+    case ArithmeticOp::SUB:
+      return CompileTimeValue{.doubleValue = lhs.doubleValue - rhs.doubleValue};
+    case ArithmeticOp::MUL:
+      return CompileTimeValue{.doubleValue = lhs.doubleValue * rhs.doubleValue};
+    case ArithmeticOp::DIV:
+      return CompileTimeValue{.doubleValue = lhs.doubleValue / rhs.doubleValue};
+    case ArithmeticOp::REM:
+      return CompileTimeValue{.doubleValue = std::fmod(lhs.doubleValue, rhs.doubleValue)};
+    default:
+      throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "Invalid operator for double operands");
+    }
+  }
+
+  if (type.is(TY_BOOL)) {
+    switch (op) {
+    case ArithmeticOp::AND:
+      return CompileTimeValue{.boolValue = lhs.boolValue && rhs.boolValue};
+    case ArithmeticOp::OR:
+      return CompileTimeValue{.boolValue = lhs.boolValue || rhs.boolValue};
+    case ArithmeticOp::XOR:
+      return CompileTimeValue{.boolValue = lhs.boolValue != rhs.boolValue};
+    default:
+      throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "Invalid operator for bool operands");
+    }
+  }
+
+  // Integer arithmetic is done on 64 bit with wrap-around semantics and truncated to the width of the type afterward
+  const bool isUnsigned = type.isUnsigned();
+  const auto lhsBits = static_cast<uint64_t>(lhs.longValue);
+  const auto rhsBits = static_cast<uint64_t>(rhs.longValue);
+  uint64_t result;
+  switch (op) {
+  case ArithmeticOp::ADD:
+    result = lhsBits + rhsBits;
+    break;
+  case ArithmeticOp::SUB:
+    result = lhsBits - rhsBits;
+    break;
+  case ArithmeticOp::MUL:
+    result = lhsBits * rhsBits;
+    break;
+  case ArithmeticOp::DIV: // fall-through
+  case ArithmeticOp::REM: {
+    if (rhsBits == 0)
+      throw SemanticError(node, DIVISION_BY_ZERO, "Dividing by zero is not allowed.");
+    const bool isDiv = op == ArithmeticOp::DIV;
+    if (isUnsigned)
+      result = isDiv ? lhsBits / rhsBits : lhsBits % rhsBits;
+    else if (rhs.longValue == -1) // Avoid overflow of INT64_MIN / -1
+      result = isDiv ? 0 - lhsBits : 0;
+    else
+      result = static_cast<uint64_t>(isDiv ? lhs.longValue / rhs.longValue : lhs.longValue % rhs.longValue);
+    break;
+  }
+  case ArithmeticOp::AND:
+    result = lhsBits & rhsBits;
+    break;
+  case ArithmeticOp::OR:
+    result = lhsBits | rhsBits;
+    break;
+  case ArithmeticOp::XOR:
+    result = lhsBits ^ rhsBits;
+    break;
+  case ArithmeticOp::SHL: // fall-through
+  case ArithmeticOp::SHR: {
+    // Shift counts are taken modulo the bit width of the type, like the shift instructions of x86 and ARM do
+    const uint64_t shiftCount = rhsBits & (getBitWidth(type) - 1);
+    if (op == ArithmeticOp::SHL)
+      result = lhsBits << shiftCount;
+    else
+      result = isUnsigned ? lhsBits >> shiftCount : static_cast<uint64_t>(lhs.longValue >> shiftCount);
+    break;
+  }
+  default:                                                                              // GCOV_EXCL_LINE
+    throw CompilerError(UNHANDLED_BRANCH, "CompileTimeEvaluator: Operator fall-through"); // GCOV_EXCL_LINE
+  }
+  return CompileTimeValue{.longValue = normalize(static_cast<int64_t>(result), type)};
+}
+
+/**
+ * Compare two values
+ *
+ * @return Negative, if lhs < rhs, zero if lhs == rhs and positive if lhs > rhs
+ */
+int CompileTimeEvaluator::compare(const CompileTimeValue &lhs, const QualType &lhsType, const CompileTimeValue &rhs,
+                                  const QualType &rhsType) {
+  if (!isSupportedType(lhsType) || !isSupportedType(rhsType))
+    throw CompilerError(UNHANDLED_BRANCH, "CompileTimeEvaluator: Unsupported operand types for comparison");
+
+  if (lhsType.is(TY_BOOL) && rhsType.is(TY_BOOL))
+    return static_cast<int>(lhs.boolValue) - static_cast<int>(rhs.boolValue);
+
+  if (lhsType.is(TY_DOUBLE) || rhsType.is(TY_DOUBLE)) {
+    const QualType doubleType(TY_DOUBLE);
+    const double lhsValue = convert(lhs, lhsType, doubleType).doubleValue;
+    const double rhsValue = convert(rhs, rhsType, doubleType).doubleValue;
+    return lhsValue < rhsValue ? -1 : (lhsValue > rhsValue ? 1 : 0);
+  }
+
+  if (lhsType.isUnsigned() && rhsType.isUnsigned()) {
+    const auto lhsValue = static_cast<uint64_t>(lhs.longValue);
+    const auto rhsValue = static_cast<uint64_t>(rhs.longValue);
+    return lhsValue < rhsValue ? -1 : (lhsValue > rhsValue ? 1 : 0);
+  }
+  return lhs.longValue < rhs.longValue ? -1 : (lhs.longValue > rhs.longValue ? 1 : 0);
+}
+
+/**
+ * Convert a value from one type to another. Integer values are kept sign- or zero-extended in the long value field.
+ *
+ * @param value Value to convert
+ * @param srcType Type of the given value
+ * @param dstType Requested type
+ * @return Converted value
+ */
+CompileTimeValue CompileTimeEvaluator::convert(const CompileTimeValue &value, const QualType &srcType, const QualType &dstType) {
+  if (dstType.is(TY_DOUBLE)) {
+    if (srcType.is(TY_DOUBLE))
+      return value;
+    if (srcType.isUnsigned())
+      return CompileTimeValue{.doubleValue = static_cast<double>(static_cast<uint64_t>(value.longValue))};
+    return CompileTimeValue{.doubleValue = static_cast<double>(value.longValue)};
+  }
+
+  if (dstType.is(TY_BOOL))
+    return CompileTimeValue{.boolValue = srcType.is(TY_BOOL) ? value.boolValue : value.longValue != 0};
+
+  int64_t rawValue = value.longValue;
+  if (srcType.is(TY_DOUBLE))
+    rawValue = static_cast<int64_t>(value.doubleValue);
+  else if (srcType.is(TY_BOOL))
+    rawValue = value.boolValue ? 1 : 0;
+  return CompileTimeValue{.longValue = normalize(rawValue, dstType)};
+}
+
+/**
+ * Convert a compile-time value from the layout, that is used by constants, to the layout of the evaluator
+ */
+CompileTimeValue CompileTimeEvaluator::fromStorageLayout(const CompileTimeValue &value, const QualType &type) {
+  if (type.is(TY_INT))
+    return CompileTimeValue{.longValue = normalize(value.intValue, type)};
+  if (type.is(TY_SHORT))
+    return CompileTimeValue{.longValue = normalize(value.shortValue, type)};
+  if (type.isOneOf({TY_BYTE, TY_CHAR}))
+    return CompileTimeValue{.longValue = normalize(value.charValue, type)};
+  return value;
+}
+
+/**
+ * Convert a compile-time value from the layout of the evaluator to the layout, that is used by constants
+ */
+CompileTimeValue CompileTimeEvaluator::toStorageLayout(const CompileTimeValue &value, const QualType &type) {
+  CompileTimeValue result = value;
+  if (type.is(TY_INT))
+    result.intValue = static_cast<int32_t>(value.longValue);
+  else if (type.is(TY_SHORT))
+    result.shortValue = static_cast<int16_t>(value.longValue);
+  else if (type.isOneOf({TY_BYTE, TY_CHAR}))
+    result.charValue = static_cast<int8_t>(value.longValue);
+  return result;
+}
+
+CompileTimeEvaluator::ArithmeticOp CompileTimeEvaluator::getArithmeticOp(ShiftExprNode::ShiftOp op) {
+  return op == ShiftExprNode::ShiftOp::OP_SHIFT_LEFT ? ArithmeticOp::SHL : ArithmeticOp::SHR;
+}
+
+CompileTimeEvaluator::ArithmeticOp CompileTimeEvaluator::getArithmeticOp(AdditiveExprNode::AdditiveOp op) {
+  return op == AdditiveExprNode::AdditiveOp::OP_PLUS ? ArithmeticOp::ADD : ArithmeticOp::SUB;
+}
+
+CompileTimeEvaluator::ArithmeticOp CompileTimeEvaluator::getArithmeticOp(MultiplicativeExprNode::MultiplicativeOp op) {
+  switch (op) {
+  case MultiplicativeExprNode::MultiplicativeOp::OP_MUL:
+    return ArithmeticOp::MUL;
+  case MultiplicativeExprNode::MultiplicativeOp::OP_DIV:
+    return ArithmeticOp::DIV;
+  default:
+    return ArithmeticOp::REM;
+  }
+}
+
+CompileTimeEvaluator::ArithmeticOp CompileTimeEvaluator::getArithmeticOp(AssignExprNode::AssignOp op) {
+  switch (op) {
+  case AssignExprNode::AssignOp::OP_PLUS_EQUAL:
+    return ArithmeticOp::ADD;
+  case AssignExprNode::AssignOp::OP_MINUS_EQUAL:
+    return ArithmeticOp::SUB;
+  case AssignExprNode::AssignOp::OP_MUL_EQUAL:
+    return ArithmeticOp::MUL;
+  case AssignExprNode::AssignOp::OP_DIV_EQUAL:
+    return ArithmeticOp::DIV;
+  case AssignExprNode::AssignOp::OP_REM_EQUAL:
+    return ArithmeticOp::REM;
+  case AssignExprNode::AssignOp::OP_SHL_EQUAL:
+    return ArithmeticOp::SHL;
+  case AssignExprNode::AssignOp::OP_SHR_EQUAL:
+    return ArithmeticOp::SHR;
+  case AssignExprNode::AssignOp::OP_AND_EQUAL:
+    return ArithmeticOp::AND;
+  case AssignExprNode::AssignOp::OP_OR_EQUAL:
+    return ArithmeticOp::OR;
+  case AssignExprNode::AssignOp::OP_XOR_EQUAL:
+    return ArithmeticOp::XOR;
+  default:                                                                                    // GCOV_EXCL_LINE
+    throw CompilerError(UNHANDLED_BRANCH, "CompileTimeEvaluator: Assign operator fall-through"); // GCOV_EXCL_LINE
+  }
+}
+
+/**
+ * Truncate the given value to the bit width of the given integer type and sign- or zero-extend it to 64 bit afterward
+ *
+ * @param value Input value
+ * @param type Integer type
+ * @return Normalized value
+ */
+int64_t CompileTimeEvaluator::normalize(int64_t value, const QualType &type) {
+  const unsigned int bitWidth = getBitWidth(type);
+  if (bitWidth == 64)
+    return value;
+  const uint64_t mask = (1ULL << bitWidth) - 1;
+  uint64_t bits = static_cast<uint64_t>(value) & mask;
+  if (type.isSigned() && (bits >> (bitWidth - 1) & 1))
+    bits |= ~mask;
+  return static_cast<int64_t>(bits);
+}
+
+unsigned int CompileTimeEvaluator::getBitWidth(const QualType &type) {
+  if (type.is(TY_INT))
+    return 32;
+  if (type.is(TY_SHORT))
+    return 16;
+  if (type.isOneOf({TY_BYTE, TY_CHAR}))
+    return 8;
+  return 64;
+}
+
+} // namespace spice::compiler
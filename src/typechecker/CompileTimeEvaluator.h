@@ -0,0 +1,128 @@
+// Copyright (c) 2021-2025 ChilliBits. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <ast/ASTNodes.h>
+#include <ast/ParallelizableASTVisitor.h>
+
+namespace spice::compiler {
+
+// Forward declarations
+class Function;
+class SymbolTableEntry;
+
+/**
+ * Interpreter for functions, that are annotated with the core.compiler.compileTime attribute.
+ * The evaluation runs on the typed AST during type checking. Supported are primitive scalar values, local variables,
+ * control structures and calls to other compile-time functions. The results are stored as compile-time values, so that
+ * they can be emitted as LLVM constants and used e.g. as array sizes.
+ */
+class CompileTimeEvaluator final : public ParallelizableASTVisitor {
+public:
+  // Public methods
+  [[nodiscard]] CompileTimeValue evaluateCall(const FctCallNode *node, const QualType &targetType);
+  [[nodiscard]] static bool isSupportedType(const QualType &qualType);
+
+  // Control structures
+  std::any visitUnsafeBlockDef(const UnsafeBlockNode *node) override;
+  std::any visitForLoop(const ForLoopNode *node) override;
+  std::any visitForeachLoop(const ForeachLoopNode *node) override;
+  std::any visitWhileLoop(const WhileLoopNode *node) override;
+  std::any visitDoWhileLoop(const DoWhileLoopNode *node) override;
+  std::any visitIfStmt(const IfStmtNode *node) override;
+  std::any visitElseStmt(const ElseStmtNode *node) override;
+  std::any visitSwitchStmt(const SwitchStmtNode *node) override;
+  std::any visitAnonymousBlockStmt(const AnonymousBlockStmtNode *node) override;
+  // Statements
+  std::any visitDeclStmt(const DeclStmtNode *node) override;
+  std::any visitExprStmt(const ExprStmtNode *node) override;
+  std::any visitReturnStmt(const ReturnStmtNode *node) override;
+  std::any visitBreakStmt(const BreakStmtNode *node) override;
+  std::any visitContinueStmt(const ContinueStmtNode *node) override;
+  std::any visitFallthroughStmt(const FallthroughStmtNode *node) override;
+  std::any visitAssertStmt(const AssertStmtNode *node) override;
+  // Expressions
+  std::any visitAssignExpr(const AssignExprNode *node) override;
+  std::any visitTernaryExpr(const TernaryExprNode *node) override;
+  std::any visitLogicalOrExpr(const LogicalOrExprNode *node) override;
+  std::any visitLogicalAndExpr(const LogicalAndExprNode *node) override;
+  std::any visitBitwiseOrExpr(const BitwiseOrExprNode *node) override;
+  std::any visitBitwiseXorExpr(const BitwiseXorExprNode *node) override;
+  std::any visitBitwiseAndExpr(const BitwiseAndExprNode *node) override;
+  std::any visitEqualityExpr(const EqualityExprNode *node) override;
+  std::any visitRelationalExpr(const RelationalExprNode *node) override;
+  std::any visitShiftExpr(const ShiftExprNode *node) override;
+  std::any visitAdditiveExpr(const AdditiveExprNode *node) override;
+  std::any visitMultiplicativeExpr(const MultiplicativeExprNode *node) override;
+  std::any visitCastExpr(const CastExprNode *node) override;
+  std::any visitPrefixUnaryExpr(const PrefixUnaryExprNode *node) override;
+  std::any visitPostfixUnaryExpr(const PostfixUnaryExprNode *node) override;
+  std::any visitAtomicExpr(const AtomicExprNode *node) override;
+
+private:
+  // Enums
+  enum class ControlFlow : uint8_t {
+    NONE,
+    BREAK,
+    CONTINUE,
+    RETURN,
+  };
+  enum class ArithmeticOp : uint8_t {
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    REM,
+    AND,
+    OR,
+    XOR,
+    SHL,
+    SHR,
+  };
+
+  // Structs
+  struct Frame {
+    std::unordered_map<const SymbolTableEntry *, CompileTimeValue> variables;
+    const Function *function = nullptr;
+    const SymbolTableEntry *resultEntry = nullptr;
+    CompileTimeValue returnValue;
+    int pendingLoopExits = 0;
+  };
+
+  // Private members
+  std::vector<Frame> frames;
+  size_t executedSteps = 0;
+
+  // Private methods
+  CompileTimeValue call(const FctCallNode *node);
+  ControlFlow execute(const StmtLstNode *node);
+  ControlFlow executeStmt(const StmtNode *node);
+  ControlFlow executeLoopBody(const StmtLstNode *body, bool &exitLoop);
+  CompileTimeValue evaluate(const ASTNode *node);
+  template <typename T> CompileTimeValue evaluateOperatorChain(const T *node, ArithmeticOp op);
+  template <typename T> CompileTimeValue evaluateOpQueue(const T *node);
+  bool evaluateCondition(const AssignExprNode *node);
+  CompileTimeValue load(const ASTNode *node, const SymbolTableEntry *entry);
+  void store(const SymbolTableEntry *entry, const CompileTimeValue &value);
+  const SymbolTableEntry *getVariableEntry(const ASTNode *node) const;
+  void countStep(const ASTNode *node);
+  static QualType getType(const ASTNode *node);
+  static CompileTimeValue applyArithmeticOp(const ASTNode *node, ArithmeticOp op, const CompileTimeValue &lhs,
+                                            const CompileTimeValue &rhs, const QualType &type);
+  static int compare(const CompileTimeValue &lhs, const QualType &lhsType, const CompileTimeValue &rhs, const QualType &rhsType);
+  static CompileTimeValue convert(const CompileTimeValue &value, const QualType &srcType, const QualType &dstType);
+  static CompileTimeValue fromStorageLayout(const CompileTimeValue &value, const QualType &type);
+  static CompileTimeValue toStorageLayout(const CompileTimeValue &value, const QualType &type);
+  static ArithmeticOp getArithmeticOp(ShiftExprNode::ShiftOp op);
+  static ArithmeticOp getArithmeticOp(AdditiveExprNode::AdditiveOp op);
+  static ArithmeticOp getArithmeticOp(MultiplicativeExprNode::MultiplicativeOp op);
+  static ArithmeticOp getArithmeticOp(AssignExprNode::AssignOp op);
+  static int64_t normalize(int64_t value, const QualType &type);
+  static unsigned int getBitWidth(const QualType &type);
+};
+
+} // namespace spice::compiler
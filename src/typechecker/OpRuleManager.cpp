@@ -185,6 +185,10 @@ ExprResult OpRuleManager::getPlusEqualResultType(ASTNode *node, const ExprResult
     return {lhs};
   }
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return {validateSimdOperation(node, PLUS_EQUAL_OP_RULES, std::size(PLUS_EQUAL_OP_RULES), "+=", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, PLUS_EQUAL_OP_RULES, std::size(PLUS_EQUAL_OP_RULES), "+=", lhsType, rhsType)};
 }
 
@@ -207,6 +211,10 @@ ExprResult OpRuleManager::getMinusEqualResultType(ASTNode *node, const ExprResul
     return {lhs};
   }
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return {validateSimdOperation(node, MINUS_EQUAL_OP_RULES, std::size(MINUS_EQUAL_OP_RULES), "-=", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, MINUS_EQUAL_OP_RULES, std::size(MINUS_EQUAL_OP_RULES), "-=", lhsType, rhsType)};
 }
 
@@ -223,6 +231,10 @@ ExprResult OpRuleManager::getMulEqualResultType(ASTNode *node, const ExprResult
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return {validateSimdOperation(node, MUL_EQUAL_OP_RULES, std::size(MUL_EQUAL_OP_RULES), "*=", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, MUL_EQUAL_OP_RULES, std::size(MUL_EQUAL_OP_RULES), "*=", lhsType, rhsType)};
 }
 
@@ -239,6 +251,10 @@ ExprResult OpRuleManager::getDivEqualResultType(ASTNode *node, const ExprResult
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return {validateSimdOperation(node, DIV_EQUAL_OP_RULES, std::size(DIV_EQUAL_OP_RULES), "/=", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, DIV_EQUAL_OP_RULES, std::size(DIV_EQUAL_OP_RULES), "/=", lhsType, rhsType)};
 }
 
@@ -250,6 +266,10 @@ QualType OpRuleManager::getRemEqualResultType(const ASTNode *node, const ExprRes
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return validateSimdOperation(node, REM_EQUAL_OP_RULES, std::size(REM_EQUAL_OP_RULES), "%=", lhsType, rhsType);
+
   return validateBinaryOperation(node, REM_EQUAL_OP_RULES, std::size(REM_EQUAL_OP_RULES), "%=", lhsType, rhsType);
 }
 
@@ -261,6 +281,10 @@ QualType OpRuleManager::getSHLEqualResultType(const ASTNode *node, const ExprRes
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return validateSimdOperation(node, SHL_EQUAL_OP_RULES, std::size(SHL_EQUAL_OP_RULES), "<<=", lhsType, rhsType);
+
   return validateBinaryOperation(node, SHL_EQUAL_OP_RULES, std::size(SHL_EQUAL_OP_RULES), "<<=", lhsType, rhsType);
 }
 
@@ -272,6 +296,10 @@ QualType OpRuleManager::getSHREqualResultType(const ASTNode *node, const ExprRes
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return validateSimdOperation(node, SHR_EQUAL_OP_RULES, std::size(SHR_EQUAL_OP_RULES), ">>=", lhsType, rhsType);
+
   return validateBinaryOperation(node, SHR_EQUAL_OP_RULES, std::size(SHR_EQUAL_OP_RULES), ">>=", lhsType, rhsType);
 }
 
@@ -283,6 +311,10 @@ QualType OpRuleManager::getAndEqualResultType(const ASTNode *node, const ExprRes
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return validateSimdOperation(node, AND_EQUAL_OP_RULES, std::size(AND_EQUAL_OP_RULES), "&=", lhsType, rhsType);
+
   return validateBinaryOperation(node, AND_EQUAL_OP_RULES, std::size(AND_EQUAL_OP_RULES), "&=", lhsType, rhsType);
 }
 
@@ -294,6 +326,10 @@ QualType OpRuleManager::getOrEqualResultType(const ASTNode *node, const ExprResu
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return validateSimdOperation(node, OR_EQUAL_OP_RULES, std::size(OR_EQUAL_OP_RULES), "|=", lhsType, rhsType);
+
   return validateBinaryOperation(node, OR_EQUAL_OP_RULES, std::size(OR_EQUAL_OP_RULES), "|=", lhsType, rhsType);
 }
 
@@ -305,6 +341,10 @@ QualType OpRuleManager::getXorEqualResultType(const ASTNode *node, const ExprRes
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return validateSimdOperation(node, XOR_EQUAL_OP_RULES, std::size(XOR_EQUAL_OP_RULES), "^=", lhsType, rhsType);
+
   return validateBinaryOperation(node, XOR_EQUAL_OP_RULES, std::size(XOR_EQUAL_OP_RULES), "^=", lhsType, rhsType);
 }
 
@@ -329,6 +369,10 @@ QualType OpRuleManager::getBitwiseOrResultType(const ASTNode *node, const ExprRe
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return validateSimdOperation(node, BITWISE_OR_OP_RULES, std::size(BITWISE_OR_OP_RULES), "|", lhsType, rhsType);
+
   return validateBinaryOperation(node, BITWISE_OR_OP_RULES, std::size(BITWISE_OR_OP_RULES), "|", lhsType, rhsType);
 }
 
@@ -337,6 +381,10 @@ QualType OpRuleManager::getBitwiseXorResultType(const ASTNode *node, const ExprR
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return validateSimdOperation(node, BITWISE_XOR_OP_RULES, std::size(BITWISE_XOR_OP_RULES), "^", lhsType, rhsType);
+
   return validateBinaryOperation(node, BITWISE_XOR_OP_RULES, std::size(BITWISE_XOR_OP_RULES), "^", lhsType, rhsType);
 }
 
@@ -345,6 +393,10 @@ QualType OpRuleManager::getBitwiseAndResultType(const ASTNode *node, const ExprR
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return validateSimdOperation(node, BITWISE_AND_OP_RULES, std::size(BITWISE_AND_OP_RULES), "&", lhsType, rhsType);
+
   return validateBinaryOperation(node, BITWISE_AND_OP_RULES, std::size(BITWISE_AND_OP_RULES), "&", lhsType, rhsType);
 }
 
@@ -442,6 +494,10 @@ ExprResult OpRuleManager::getShiftLeftResultType(ASTNode *node, const ExprResult
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return {validateSimdOperation(node, SHIFT_LEFT_OP_RULES, std::size(SHIFT_LEFT_OP_RULES), "<<", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, SHIFT_LEFT_OP_RULES, std::size(SHIFT_LEFT_OP_RULES), "<<", lhsType, rhsType)};
 }
 
@@ -455,6 +511,10 @@ ExprResult OpRuleManager::getShiftRightResultType(ASTNode *node, const ExprResul
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return {validateSimdOperation(node, SHIFT_RIGHT_OP_RULES, std::size(SHIFT_RIGHT_OP_RULES), ">>", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, SHIFT_RIGHT_OP_RULES, std::size(SHIFT_RIGHT_OP_RULES), ">>", lhsType, rhsType)};
 }
 
@@ -479,6 +539,10 @@ ExprResult OpRuleManager::getPlusResultType(ASTNode *node, const ExprResult &lhs
     return {rhsType};
   }
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return {validateSimdOperation(node, PLUS_OP_RULES, std::size(PLUS_OP_RULES), "+", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, PLUS_OP_RULES, std::size(PLUS_OP_RULES), "+", lhsType, rhsType)};
 }
 
@@ -503,6 +567,10 @@ ExprResult OpRuleManager::getMinusResultType(ASTNode *node, const ExprResult &lh
     return {rhs};
   }
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return {validateSimdOperation(node, MINUS_OP_RULES, std::size(MINUS_OP_RULES), "-", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, MINUS_OP_RULES, std::size(MINUS_OP_RULES), "-", lhsType, rhsType)};
 }
 
@@ -516,6 +584,10 @@ ExprResult OpRuleManager::getMulResultType(ASTNode *node, const ExprResult &lhs,
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return {validateSimdOperation(node, MUL_OP_RULES, std::size(MUL_OP_RULES), "*", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, MUL_OP_RULES, std::size(MUL_OP_RULES), "*", lhsType, rhsType)};
 }
 
@@ -529,6 +601,10 @@ ExprResult OpRuleManager::getDivResultType(ASTNode *node, const ExprResult &lhs,
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return {validateSimdOperation(node, DIV_OP_RULES, std::size(DIV_OP_RULES), "/", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, DIV_OP_RULES, std::size(DIV_OP_RULES), "/", lhsType, rhsType)};
 }
 
@@ -537,6 +613,10 @@ ExprResult OpRuleManager::getRemResultType(const ASTNode *node, const ExprResult
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Check if this is an element-wise SIMD operation
+  if (lhsType.isArray() && rhsType.isArray())
+    return {validateSimdOperation(node, REM_OP_RULES, std::size(REM_OP_RULES), "%", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, REM_OP_RULES, std::size(REM_OP_RULES), "%", lhsType, rhsType)};
 }
 
@@ -760,6 +840,22 @@ QualType OpRuleManager::validateBinaryOperation(const ASTNode *node, const Binar
   throw getExceptionBinary(node, name, lhs, rhs, customMessagePrefix);
 }
 
+QualType OpRuleManager::validateSimdOperation(const ASTNode *node, const BinaryOpRule opRules[], size_t opRulesSize,
+                                              const char *name, const QualType &lhs, const QualType &rhs) {
+  // Both operands need to be vectors of the same length and element type
+  const bool bothVectors = lhs.isSimdVector() && rhs.isSimdVector();
+  if (bothVectors && lhs.getArraySize() == rhs.getArraySize() && lhs.getContained().is(rhs.getContained().getSuperType())) {
+    // The operator has to be applicable lane-wise without changing the element type
+    const SuperType elementType = lhs.getContained().getSuperType();
+    for (size_t i = 0; i < opRulesSize; i++) {
+      const BinaryOpRule &rule = opRules[i];
+      if (std::get<0>(rule) == elementType && std::get<1>(rule) == elementType && std::get<2>(rule) == elementType)
+        return lhs.toNonConst();
+    }
+  }
+  throw getExceptionBinary(node, name, lhs, rhs, "");
+}
+
 SemanticError OpRuleManager::getExceptionUnary(const ASTNode *node, const char *name, const QualType &lhs) {
   return {node, OPERATOR_WRONG_DATA_TYPE, "Cannot apply '" + std::string(name) + "' operator on type " + lhs.getName(true)};
 }
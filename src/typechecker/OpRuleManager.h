@@ -657,6 +657,8 @@ private:
   static QualType validateBinaryOperation(const ASTNode *node, const BinaryOpRule opRules[], size_t opRulesSize, const char *name,
                                           const QualType &lhs, const QualType &rhs, bool preserveQualifiersFromLhs = false,
                                           const char *customMessagePrefix = "");
+  static QualType validateSimdOperation(const ASTNode *node, const BinaryOpRule opRules[], size_t opRulesSize, const char *name,
+                                        const QualType &lhs, const QualType &rhs);
   static SemanticError getExceptionUnary(const ASTNode *node, const char *name, const QualType &lhs);
   static SemanticError getExceptionBinary(const ASTNode *node, const char *name, const QualType &lhs, const QualType &rhs,
                                           const char *messagePrefix);
@@ -2,8 +2,10 @@
 
 #include "StructManager.h"
 
+#include <SourceFile.h>
 #include <ast/ASTNodes.h>
 #include <exception/SemanticError.h>
+#include <global/GlobalResourceManager.h>
 #include <symboltablebuilder/Scope.h>
 #include <symboltablebuilder/SymbolTableBuilder.h>
 #include <typechecker/TypeMatcher.h>
@@ -196,6 +198,31 @@ Struct *StructManager::match(Scope *matchScope, const std::string &qt, const Qua
   return matches.front();
 }
 
+/**
+ * Collect all fully substantiated struct manifestations of the whole program, that implement the given interface.
+ * This only yields a complete result after all source files were type-checked.
+ *
+ * @param spiceInterface Interface to search implementors for
+ * @param resourceManager Global resource manager, owning all source files of the program
+ * @return List of implementing structs
+ */
+std::vector<const Struct *> StructManager::getImplementors(const Interface *spiceInterface,
+                                                           const GlobalResourceManager &resourceManager) {
+  std::vector<const Struct *> implementors;
+  for (const std::unique_ptr<SourceFile> &sourceFile : resourceManager.sourceFiles | std::views::values) {
+    for (const Struct *manifestation : sourceFile->globalScope->getAllStructManifestationsInDeclarationOrder()) {
+      // Skip generic structs, that were not substantiated
+      if (!manifestation->isFullySubstantiated())
+        continue;
+      // Check if the struct implements the interface
+      const auto pred = [&](const QualType &interfaceType) { return interfaceType.getInterface(nullptr) == spiceInterface; };
+      if (std::ranges::any_of(manifestation->interfaceTypes, pred))
+        implementors.push_back(manifestation);
+    }
+  }
+  return implementors;
+}
+
 /**
  * Checks if the matching candidate fulfills the name requirement
  *
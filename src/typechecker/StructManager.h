@@ -14,6 +14,8 @@ namespace spice::compiler {
 // Forward declarations
 struct CodeLoc;
 class Struct;
+class Interface;
+class GlobalResourceManager;
 class Scope;
 class Type;
 class ASTNode;
@@ -29,6 +31,8 @@ public:
   static Struct *insert(Scope *insertScope, Struct &spiceStruct, std::vector<Struct *> *nodeStructList);
   [[nodiscard]] static Struct *match(Scope *matchScope, const std::string &qt, const QualTypeList &reqTemplateTypes,
                                      const ASTNode *node);
+  [[nodiscard]] static std::vector<const Struct *> getImplementors(const Interface *spiceInterface,
+                                                                   const GlobalResourceManager &resourceManager);
   static void clear();
 
 private:
@@ -26,6 +26,12 @@ std::any TypeChecker::visitEntry(EntryNode *node) {
   if (isPrepare)
     node->resizeToNumberOfManifestations(1);
 
+  // Evaluate global initializers, that are computed at compile time, first to make their values available in all functions
+  if (!isPrepare)
+    for (TopLevelDefNode *topLevelDef : node->topLevelDefs)
+      if (const auto globalVarDef = dynamic_cast<GlobalVarDefNode *>(topLevelDef); globalVarDef && globalVarDef->fctCall)
+        visit(globalVarDef);
+
   // Visit children
   visitChildren(node);
 
@@ -98,7 +104,7 @@ std::any TypeChecker::visitAliasDef(AliasDefNode *node) {
 std::any TypeChecker::visitGlobalVarDef(GlobalVarDefNode *node) {
   if (typeCheckerMode == TC_MODE_PRE)
     return visitGlobalVarDefPrepare(node);
-  return nullptr;
+  return visitGlobalVarDefCheck(node);
 }
 
 std::any TypeChecker::visitExtDecl(ExtDeclNode *node) {
@@ -339,9 +345,10 @@ std::any TypeChecker::visitSwitchStmt(SwitchStmtNode *node) {
   // Check expression type
   const QualType exprType = std::any_cast<ExprResult>(visit(node->assignExpr)).type;
   HANDLE_UNRESOLVED_TYPE_PTR(exprType)
-  if (!exprType.isOneOf({TY_INT, TY_SHORT, TY_LONG, TY_BYTE, TY_CHAR, TY_BOOL}))
+  const bool isStringObjSwitch = exprType.removeReferenceWrapper().isStringObj();
+  if (!exprType.isOneOf({TY_INT, TY_SHORT, TY_LONG, TY_BYTE, TY_CHAR, TY_BOOL, TY_STRING}) && !isStringObjSwitch)
     SOFT_ERROR_ER(node->assignExpr, SWITCH_EXPR_MUST_BE_PRIMITIVE,
-                  "Switch expression must be of int, short, long, byte, char or bool type")
+                  "Switch expression must be of int, short, long, byte, char, bool, string or String type")
 
   // Visit children
   visitChildren(node);
@@ -350,7 +357,9 @@ std::any TypeChecker::visitSwitchStmt(SwitchStmtNode *node) {
   for (const CaseBranchNode *caseBranchNode : node->caseBranches)
     for (CaseConstantNode *constantNode : caseBranchNode->caseConstants) {
       const QualType constantType = std::any_cast<ExprResult>(visit(constantNode)).type;
-      if (!constantType.matches(exprType, false, true, true))
+      // String objects can be matched against string literals
+      const bool matches = isStringObjSwitch ? constantType.is(TY_STRING) : constantType.matches(exprType, false, true, true);
+      if (!matches)
         SOFT_ERROR_ER(constantNode, SWITCH_CASE_TYPE_MISMATCH, "Case value type does not match the switch expression type")
     }
 
@@ -734,6 +743,12 @@ std::any TypeChecker::visitBuiltinCall(BuiltinCallNode *node) {
     return visitPanicCall(node->panicCall);
   if (node->sysCall)
     return visitSysCall(node->sysCall);
+  if (node->shuffleCall)
+    return visitShuffleCall(node->shuffleCall);
+  if (node->reduceCall)
+    return visitReduceCall(node->reduceCall);
+  if (node->atomicCall)
+    return visitAtomicCall(node->atomicCall);
   assert_fail("Unknown builtin call");
   return nullptr;
 }
@@ -888,6 +903,128 @@ std::any TypeChecker::visitSysCall(SysCallNode *node) {
   return ExprResult{node->setEvaluatedSymbolType(QualType(TY_LONG), manIdx)};
 }
 
+std::any TypeChecker::visitShuffleCall(ShuffleCallNode *node) {
+  QualType vectorType = std::any_cast<ExprResult>(visit(node->vector)).type;
+  HANDLE_UNRESOLVED_TYPE_ER(vectorType)
+  vectorType = vectorType.removeReferenceWrapper();
+
+  // Check if the arg can be used as SIMD vector
+  if (!vectorType.isSimdVector())
+    SOFT_ERROR_ER(node->vector, INVALID_SIMD_VECTOR, "The shuffle builtin only works on fixed-size arrays of numeric types")
+
+  // Check if all lane indices are known at compile time and in range
+  node->laneIndices.clear();
+  for (AssignExprNode *index : node->indices) {
+    const QualType indexType = std::any_cast<ExprResult>(visit(index)).type;
+    HANDLE_UNRESOLVED_TYPE_ER(indexType)
+    if (!indexType.isOneOf({TY_INT, TY_SHORT, TY_LONG}) || !index->hasCompileTimeValue())
+      SOFT_ERROR_ER(index, INVALID_SHUFFLE_INDEX, "Shuffle indices must be integers, that are known at compile time")
+    const CompileTimeValue indexValue = index->getCompileTimeValue();
+    int64_t laneIdx = indexValue.longValue;
+    if (indexType.is(TY_INT))
+      laneIdx = indexValue.intValue;
+    else if (indexType.is(TY_SHORT))
+      laneIdx = indexValue.shortValue;
+    if (laneIdx < 0 || laneIdx >= static_cast<int64_t>(vectorType.getArraySize()))
+      SOFT_ERROR_ER(index, INVALID_SHUFFLE_INDEX,
+                    "Shuffle index " + std::to_string(laneIdx) + " is out of range for a vector with " +
+                        std::to_string(vectorType.getArraySize()) + " lanes")
+    node->laneIndices.push_back(static_cast<int>(laneIdx));
+  }
+
+  const QualType resultType = vectorType.getContained().toArr(node, node->indices.size());
+  return ExprResult{node->setEvaluatedSymbolType(resultType, manIdx)};
+}
+
+std::any TypeChecker::visitReduceCall(ReduceCallNode *node) {
+  QualType vectorType = std::any_cast<ExprResult>(visit(node->vector)).type;
+  HANDLE_UNRESOLVED_TYPE_ER(vectorType)
+  vectorType = vectorType.removeReferenceWrapper();
+
+  // Check if the arg can be used as SIMD vector
+  if (!vectorType.isSimdVector())
+    SOFT_ERROR_ER(node->vector, INVALID_SIMD_VECTOR, "The reduce builtin only works on fixed-size arrays of numeric types")
+
+  // Bitwise reductions are only available for integer vectors
+  const QualType elementType = vectorType.getContained();
+  const bool isBitwiseOp = node->op == ReduceCallNode::ReduceOp::OP_BITWISE_AND ||
+                           node->op == ReduceCallNode::ReduceOp::OP_BITWISE_OR ||
+                           node->op == ReduceCallNode::ReduceOp::OP_BITWISE_XOR;
+  if (isBitwiseOp && !elementType.isOneOf({TY_INT, TY_SHORT, TY_LONG, TY_BYTE}))
+    SOFT_ERROR_ER(node->vector, INVALID_SIMD_VECTOR, "Bitwise reductions only work on vectors of int, short, long or byte")
+
+  return ExprResult{node->setEvaluatedSymbolType(elementType, manIdx)};
+}
+
+std::any TypeChecker::visitAtomicCall(AtomicCallNode *node) {
+  // Check if the number of args matches the operation. The last arg is always the memory order
+  size_t expectedArgCount = 3;
+  if (node->op == AtomicCallNode::AtomicOp::OP_LOAD)
+    expectedArgCount = 2;
+  else if (node->op == AtomicCallNode::AtomicOp::OP_COMPARE_EXCHANGE)
+    expectedArgCount = 4;
+  if (node->args.size() != expectedArgCount)
+    SOFT_ERROR_ER(node, ATOMIC_ARG_COUNT_ERROR,
+                  "This atomic builtin expects " + std::to_string(expectedArgCount) + " args, but got " +
+                      std::to_string(node->args.size()))
+
+  // Check if the first arg is a pointer to a type, that is supported by the operation
+  QualType ptrType = std::any_cast<ExprResult>(visit(node->args.front())).type;
+  HANDLE_UNRESOLVED_TYPE_ER(ptrType)
+  ptrType = ptrType.removeReferenceWrapper();
+  if (!ptrType.isPtr())
+    SOFT_ERROR_ER(node->args.front(), INVALID_ATOMIC_TYPE, "The first arg of an atomic builtin must be a pointer")
+  const QualType valueType = ptrType.getContained().toNonConst();
+  bool isSupportedType;
+  switch (node->op) {
+  case AtomicCallNode::AtomicOp::OP_COMPARE_EXCHANGE:
+    isSupportedType = valueType.isOneOf({TY_INT, TY_SHORT, TY_LONG, TY_BYTE, TY_CHAR, TY_PTR});
+    break;
+  case AtomicCallNode::AtomicOp::OP_FETCH_ADD:
+    isSupportedType = valueType.isOneOf({TY_INT, TY_SHORT, TY_LONG, TY_BYTE, TY_CHAR, TY_DOUBLE});
+    break;
+  default:
+    isSupportedType = valueType.isOneOf({TY_INT, TY_SHORT, TY_LONG, TY_BYTE, TY_CHAR, TY_DOUBLE, TY_PTR});
+    break;
+  }
+  if (!isSupportedType)
+    SOFT_ERROR_ER(node->args.front(), INVALID_ATOMIC_TYPE,
+                  "This atomic builtin does not support values of type " + valueType.getName(false))
+  if (node->op != AtomicCallNode::AtomicOp::OP_LOAD && ptrType.getContained().isConst())
+    SOFT_ERROR_ER(node->args.front(), INVALID_ATOMIC_TYPE, "Cannot atomically modify a const value")
+
+  // Check if the value args match the pointee type
+  for (size_t i = 1; i < node->args.size() - 1; i++) {
+    QualType argType = std::any_cast<ExprResult>(visit(node->args.at(i))).type;
+    HANDLE_UNRESOLVED_TYPE_ER(argType)
+    argType = argType.removeReferenceWrapper();
+    if (!argType.matches(valueType, false, true, true))
+      SOFT_ERROR_ER(node->args.at(i), INVALID_ATOMIC_TYPE,
+                    "Expected value of type " + valueType.getName(false) + ", but got " + argType.getName(false))
+  }
+
+  // Check if the memory order is valid
+  AssignExprNode *orderNode = node->args.back();
+  QualType orderType = std::any_cast<ExprResult>(visit(orderNode)).type;
+  HANDLE_UNRESOLVED_TYPE_ER(orderType)
+  orderType = orderType.removeReferenceWrapper();
+  if (!orderType.isOneOf({TY_INT, TY_ENUM}))
+    SOFT_ERROR_ER(orderNode, INVALID_MEMORY_ORDER, "The memory order must be an int or an enum item")
+  if (orderType.is(TY_INT) && orderNode->hasCompileTimeValue()) {
+    const int32_t order = orderNode->getCompileTimeValue().intValue;
+    if (order < 0 || order > 4)
+      SOFT_ERROR_ER(orderNode, INVALID_MEMORY_ORDER, "Memory order " + std::to_string(order) + " is out of range 0-4")
+  }
+
+  // Compare exchange returns whether the exchange succeeded, store returns nothing and all others return the old value
+  QualType resultType = valueType;
+  if (node->op == AtomicCallNode::AtomicOp::OP_COMPARE_EXCHANGE)
+    resultType = QualType(TY_BOOL);
+  else if (node->op == AtomicCallNode::AtomicOp::OP_STORE)
+    resultType = QualType(TY_DYN);
+  return ExprResult{node->setEvaluatedSymbolType(resultType, manIdx)};
+}
+
 std::any TypeChecker::visitAssignExpr(AssignExprNode *node) {
   // Check if ternary
   if (node->ternaryExpr) {
@@ -1831,8 +1968,12 @@ std::any TypeChecker::visitFctCall(FctCallNode *node) {
 
       Function *copyCtor = nullptr;
       if (expectedType.is(TY_STRUCT) && actualType.is(TY_STRUCT) && !actualType.isTriviallyCopyable(node)) {
-        copyCtor = matchCopyCtor(actualType, node);
-        currentScope->symbolTable.insertAnonymous(actualType, node, argIdx + 1); // +1 because 0 is reserved for return value
+        // Temporaries are moved into the param instead of being copied. The caller destructs them after the call anyway
+        const bool isMovableTemporary = entry != nullptr && entry->anonymous;
+        if (!isMovableTemporary) {
+          copyCtor = matchCopyCtor(actualType, node);
+          currentScope->symbolTable.insertAnonymous(actualType, node, argIdx + 1); // +1 because 0 is reserved for return value
+        }
       }
 
       node->argLst->argInfos.push_back(ArgLstNode::ArgInfo{copyCtor});
@@ -2381,6 +2522,28 @@ std::any TypeChecker::visitDataType(DataTypeNode *node) {
           SOFT_ERROR_QT(node, EXPECTED_CONST_VARIABLE, "The size of the array must be known at compile time")
         if (!globalVar->getQualType().is(TY_INT))
           SOFT_ERROR_QT(node, OPERATOR_WRONG_DATA_TYPE, "Expected variable of type int")
+        if (!globalVar->declNode->hasCompileTimeValue()) {
+          // Globals, that are computed by a compile-time function, can only be evaluated when function bodies are checked
+          const auto globalVarDef = dynamic_cast<GlobalVarDefNode *>(globalVar->declNode);
+          if (!globalVarDef || !globalVarDef->fctCall)
+            SOFT_ERROR_QT(node, EXPECTED_CONST_VARIABLE, "The value of '" + varName + "' is not known at this point")
+          if (typeCheckerMode == TC_MODE_PRE)
+            SOFT_ERROR_QT(node, EXPECTED_CONST_VARIABLE,
+                          "The value of '" + varName + "' is computed at compile time and can only be used in function bodies")
+          // Evaluate the global on demand, if this did not happen yet. This might type-check other functions, so save the state
+          Scope *const prevScope = currentScope;
+          const size_t prevManIdx = manIdx;
+          TypeMapping prevTypeMapping = std::move(typeMapping);
+          typeMapping.clear();
+          currentScope = rootScope;
+          manIdx = 0;
+          visit(globalVarDef);
+          currentScope = prevScope;
+          manIdx = prevManIdx;
+          typeMapping = std::move(prevTypeMapping);
+          if (!globalVarDef->isValueComputed)
+            SOFT_ERROR_QT(node, EXPECTED_CONST_VARIABLE, "The value of '" + varName + "' is not known at this point")
+        }
         hardcodedSize = globalVar->declNode->getCompileTimeValue().intValue;
       }
 
@@ -2747,6 +2910,48 @@ void TypeChecker::requestRevisitIfRequired(const Function *fct) {
     fct->entry->scope->sourceFile->reVisitRequested = true;
 }
 
+/**
+ * Make sure, that the given compile-time function and all compile-time functions, called by it, are type-checked.
+ * Functions of the current source file are type-checked on demand.
+ *
+ * @param fct Compile-time function
+ * @param visitedFcts Already visited functions
+ * @return All functions type-checked or not
+ */
+bool TypeChecker::ensureCompileTimeFctTypeChecked(const Function *fct, // NOLINT(misc-no-recursion)
+                                                  std::unordered_set<const Function *> &visitedFcts) {
+  if (!visitedFcts.insert(fct).second)
+    return true;
+
+  // Type-check the function on demand. Functions from other source files are type-checked in the context of their source file
+  if (!fct->alreadyTypeChecked) {
+    SourceFile *fctSourceFile = fct->entry->scope->sourceFile;
+    if (fctSourceFile != sourceFile) {
+      TypeChecker typeChecker(resourceManager, fctSourceFile, TC_MODE_POST);
+      typeChecker.visit(fct->declNode);
+    } else {
+      visit(fct->declNode);
+    }
+    if (!fct->alreadyTypeChecked)
+      return false;
+  }
+
+  // Do the same for all compile-time functions, that are called in the function body
+  std::vector<const ASTNode *> worklist = {fct->declNode};
+  while (!worklist.empty()) {
+    const ASTNode *current = worklist.back();
+    worklist.pop_back();
+    if (const auto fctCall = dynamic_cast<const FctCallNode *>(current)) {
+      const Function *callee = fctCall->data.front().callee;
+      if (callee && callee->isCompileTime && !ensureCompileTimeFctTypeChecked(callee, visitedFcts))
+        return false;
+    }
+    for (const ASTNode *child : current->getChildren())
+      worklist.push_back(child);
+  }
+  return true;
+}
+
 /**
  * Add a soft error to the error list
  */
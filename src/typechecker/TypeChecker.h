@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include <CompilerPass.h>
 #include <ast/ASTVisitor.h>
 #include <model/Function.h>
@@ -60,6 +62,7 @@ public:
   std::any visitAliasDefPrepare(AliasDefNode *node);
   std::any visitGlobalVarDef(GlobalVarDefNode *node) override;
   std::any visitGlobalVarDefPrepare(GlobalVarDefNode *node);
+  std::any visitGlobalVarDefCheck(GlobalVarDefNode *node);
   std::any visitExtDecl(ExtDeclNode *node) override;
   std::any visitExtDeclPrepare(ExtDeclNode *node);
   std::any visitImportDef(ImportDefNode *node) override;
@@ -96,6 +99,9 @@ public:
   std::any visitLenCall(LenCallNode *node) override;
   std::any visitPanicCall(PanicCallNode *node) override;
   std::any visitSysCall(SysCallNode *node) override;
+  std::any visitShuffleCall(ShuffleCallNode *node) override;
+  std::any visitReduceCall(ReduceCallNode *node) override;
+  std::any visitAtomicCall(AtomicCallNode *node) override;
   // Expressions
   std::any visitAssignExpr(AssignExprNode *node) override;
   std::any visitTernaryExpr(TernaryExprNode *node) override;
@@ -147,6 +153,7 @@ private:
   static void autoDeReference(QualType &symbolType);
   std::vector<const Function *> &getOpFctPointers(ASTNode *node) const;
   static void requestRevisitIfRequired(const Function *fct);
+  bool ensureCompileTimeFctTypeChecked(const Function *fct, std::unordered_set<const Function *> &visitedFcts);
   void softError(const ASTNode *node, SemanticErrorType errorType, const std::string &message) const;
 
   // Implicit code generation
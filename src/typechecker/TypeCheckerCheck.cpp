@@ -5,6 +5,8 @@
 #include <SourceFile.h>
 #include <exception/SemanticError.h>
 #include <symboltablebuilder/SymbolTableBuilder.h>
+#include <typechecker/CompileTimeEvaluator.h>
+#include <typechecker/MacroDefs.h>
 #include <typechecker/TypeMatcher.h>
 
 namespace spice::compiler {
@@ -237,4 +239,39 @@ std::any TypeChecker::visitStructDefCheck(StructDefNode *node) {
   return nullptr;
 }
 
-} // namespace spice::compiler
\ No newline at end of file
+std::any TypeChecker::visitGlobalVarDefCheck(GlobalVarDefNode *node) {
+  // Only globals, that are initialized by a compile-time function call, need to be checked here. Skip if already evaluated
+  if (!node->fctCall || node->isValueComputed)
+    return nullptr;
+
+  // Check the function call
+  const QualType rhsType = std::any_cast<ExprResult>(visit(node->fctCall)).type;
+  HANDLE_UNRESOLVED_TYPE_PTR(rhsType)
+  const QualType &globalVarType = node->entry->getQualType();
+  if (!globalVarType.matches(rhsType, false, true, true))
+    SOFT_ERROR_BOOL(node->fctCall, OPERATOR_WRONG_DATA_TYPE,
+                    "Expected " + globalVarType.getName(false) + ", but got " + rhsType.getName(false))
+  const Function *callee = node->fctCall->data.front().callee;
+  assert(callee != nullptr);
+  if (!callee->isCompileTime)
+    SOFT_ERROR_BOOL(node->fctCall, COMPILE_TIME_EVALUATION_FAILED,
+                    "Global variables can only be initialized by calls to functions with the core.compiler.compileTime attribute")
+
+  // Make sure that all involved compile-time functions are type-checked before evaluating the call
+  std::unordered_set<const Function *> visitedFcts;
+  if (!ensureCompileTimeFctTypeChecked(callee, visitedFcts)) {
+    sourceFile->reVisitRequested = true;
+    return nullptr;
+  }
+  if (!resourceManager.errorManager.softErrors.empty())
+    return nullptr;
+
+  // Evaluate the call and save the result as value of the global
+  CompileTimeEvaluator evaluator;
+  node->computedValue = evaluator.evaluateCall(node->fctCall, globalVarType);
+  node->isValueComputed = true;
+
+  return nullptr;
+}
+
+} // namespace spice::compiler
@@ -7,6 +7,7 @@
 #include <global/GlobalResourceManager.h>
 #include <global/TypeRegistry.h>
 #include <symboltablebuilder/SymbolTableBuilder.h>
+#include <typechecker/CompileTimeEvaluator.h>
 #include <typechecker/MacroDefs.h>
 
 namespace spice::compiler {
@@ -175,6 +176,19 @@ std::any TypeChecker::visitFctDefPrepare(FctDefNode *node) {
       firstManifestation->used = true;        // Always keep test functions, because they are called implicitly by the test main
       sourceFile->testFunctions.push_back(node->manifestations.front());
     }
+    if (const CompileTimeValue *value = attrLst->getAttrValueByName(ATTR_CORE_COMPILER_COMPILE_TIME); value && value->boolValue) {
+      // Make sure that the function can be evaluated at compile time
+      if (node->isMethod || node->hasTemplateTypes)
+        throw SemanticError(node, INVALID_COMPILE_TIME_FUNCTION, "Compile-time functions must not be methods or generic");
+      if (!CompileTimeEvaluator::isSupportedType(returnType))
+        throw SemanticError(node->returnType, INVALID_COMPILE_TIME_FUNCTION,
+                            "Compile-time functions must return a value of primitive, non-string type");
+      for (const QualType &paramType : paramTypes)
+        if (!CompileTimeEvaluator::isSupportedType(paramType))
+          throw SemanticError(node->paramLst, INVALID_COMPILE_TIME_FUNCTION,
+                              "Compile-time functions must only have params of primitive, non-string type");
+      firstManifestation->isCompileTime = true;
+    }
   }
 
   // Duplicate / rename the original child scope to reflect the substantiated versions of the function
@@ -592,6 +606,10 @@ std::any TypeChecker::visitGlobalVarDefPrepare(GlobalVarDefNode *node) {
       SOFT_ERROR_BOOL(node->constant, OPERATOR_WRONG_DATA_TYPE,
                       "Expected " + globalVarType.getName(false) + ", but got " + rhsType.getName(false))
     }
+  } else if (node->fctCall) { // Variable is initialized by a compile-time function call, which is evaluated later
+    if (!globalVarType.is(TY_DYN) && !CompileTimeEvaluator::isSupportedType(globalVarType))
+      SOFT_ERROR_BOOL(node->dataType, GLOBAL_OF_INVALID_TYPE,
+                      "Global variables, initialized at compile time, must be of primitive, non-string type")
   }
 
   // Check if the type is still missing
@@ -607,7 +625,7 @@ std::any TypeChecker::visitGlobalVarDefPrepare(GlobalVarDefNode *node) {
   node->entry->updateType(globalVarType, false);
 
   // Check if a value is attached
-  if (!node->constant && globalVarType.isConst())
+  if (!node->hasValue && globalVarType.isConst())
     SOFT_ERROR_BOOL(node, GLOBAL_CONST_WITHOUT_VALUE, "You must specify a value for constant global variables")
 
   return nullptr;
@@ -79,6 +79,9 @@ public:
   std::any visitLenCall(LenCallNode *ctx) override { return buildNode(ctx); }
   std::any visitPanicCall(PanicCallNode *ctx) override { return buildNode(ctx); }
   std::any visitSysCall(SysCallNode *ctx) override { return buildNode(ctx); }
+  std::any visitShuffleCall(ShuffleCallNode *ctx) override { return buildNode(ctx); }
+  std::any visitReduceCall(ReduceCallNode *ctx) override { return buildNode(ctx); }
+  std::any visitAtomicCall(AtomicCallNode *ctx) override { return buildNode(ctx); }
   std::any visitAssignExpr(AssignExprNode *ctx) override { return buildNode(ctx); }
   std::any visitTernaryExpr(TernaryExprNode *ctx) override { return buildNode(ctx); }
   std::any visitLogicalOrExpr(LogicalOrExprNode *ctx) override { return buildNode(ctx); }
@@ -81,6 +81,9 @@ public:
   std::any visitLenCall(SpiceParser::LenCallContext *ctx) override { return buildRule(ctx); }
   std::any visitPanicCall(SpiceParser::PanicCallContext *ctx) override { return buildRule(ctx); }
   std::any visitSysCall(SpiceParser::SysCallContext *ctx) override { return buildRule(ctx); }
+  std::any visitShuffleCall(SpiceParser::ShuffleCallContext *ctx) override { return buildRule(ctx); }
+  std::any visitReduceCall(SpiceParser::ReduceCallContext *ctx) override { return buildRule(ctx); }
+  std::any visitAtomicCall(SpiceParser::AtomicCallContext *ctx) override { return buildRule(ctx); }
   std::any visitAssignExpr(SpiceParser::AssignExprContext *ctx) override { return buildRule(ctx); }
   std::any visitTernaryExpr(SpiceParser::TernaryExprContext *ctx) override { return buildRule(ctx); }
   std::any visitLogicalOrExpr(SpiceParser::LogicalOrExprContext *ctx) override { return buildRule(ctx); }
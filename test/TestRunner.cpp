@@ -3,6 +3,7 @@
 // GCOV_EXCL_START
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -19,6 +20,7 @@
 #include <exception/SemanticError.h>
 #include <global/GlobalResourceManager.h>
 #include <global/TypeRegistry.h>
+#include <irgenerator/IRGenerator.h>
 #include <symboltablebuilder/SymbolTable.h>
 #include <util/FileUtil.h>
 
@@ -33,6 +35,15 @@ void execTestCase(const TestCase &testCase) {
   if (TestUtil::isDisabled(testCase, skipNonGitHubTests))
     GTEST_SKIP();
 
+  // Read the opt level, the IR gets generated for. Optimized IR refs are checked for all opt levels regardless of it
+  OptLevel optLevel = O0;
+  if (const std::filesystem::path optLevelFile = testCase.testPath / INPUT_NAME_OPT_LEVEL; exists(optLevelFile)) {
+    static const std::unordered_map<std::string, OptLevel> OPT_LEVELS = {
+        {"O0", O0}, {"O1", O1}, {"O2", O2}, {"O3", O3}, {"Os", Os}, {"Oz", Oz},
+    };
+    optLevel = OPT_LEVELS.at(TestUtil::getFileContentLinesVector(optLevelFile).at(0));
+  }
+
   // Create fake cli options
   const std::filesystem::path sourceFilePath = testCase.testPath / REF_NAME_SOURCE;
   const llvm::Triple targetTriple(llvm::Triple::normalize(llvm::sys::getDefaultTargetTriple()));
@@ -66,9 +77,11 @@ void execTestCase(const TestCase &testCase) {
           /* abortAfterDump */ false,
       },
       /* namesForIRValues= */ true,
-      /* useLifetimeMarkers= */ false,
-      /* optLevel= */ O0,
+      /* useLifetimeMarkers= */ exists(testCase.testPath / CTL_LIFETIME_MARKERS),
+      /* optLevel= */ optLevel,
       /* useLTO= */ exists(testCase.testPath / CTL_LTO),
+      /* pgoInstrGen= */ exists(testCase.testPath / CTL_PGO_INSTR_GEN),
+      /* pgoProfileUsePath= */ "",
       /* noEntryFct= */ exists(testCase.testPath / CTL_RUN_BUILTIN_TESTS),
       /* generateTestMain= */ exists(testCase.testPath / CTL_RUN_BUILTIN_TESTS),
       /* staticLinking= */ false,
@@ -77,7 +90,7 @@ void execTestCase(const TestCase &testCase) {
       /* testMode= */ true,
   };
   static_assert(sizeof(CliOptions::DumpSettings) == 10, "CliOptions::DumpSettings struct size changed");
-  static_assert(sizeof(CliOptions) == 360, "CliOptions struct size changed");
+  static_assert(sizeof(CliOptions) == 400, "CliOptions struct size changed");
 
   // Instantiate GlobalResourceManager
   GlobalResourceManager resourceManager(cliOptions);
@@ -133,7 +146,7 @@ void execTestCase(const TestCase &testCase) {
 
     // Check unoptimized IR code
     TestUtil::checkRefMatch(
-        testCase.testPath / REF_NAME_IR, [&] { return mainSourceFile->compilerOutput.irString; },
+        testCase.testPath / REF_NAME_IR, [&] { return IRGenerator::getIRString(mainSourceFile->llvmModule.get(), true); },
         [&](std::string &expectedOutput, std::string &actualOutput) {
           if (cliOptions.generateDebugInfo) {
             // Remove the lines, containing paths on the local file system
@@ -142,9 +155,13 @@ void execTestCase(const TestCase &testCase) {
           }
         });
 
-    // Check optimized IR code
+    // Check optimized IR code. Optionally, only the IR of certain functions is compared
+    std::vector<std::string> irFunctions;
+    if (const std::filesystem::path irFunctionsFile = testCase.testPath / INPUT_NAME_IR_FUNCTIONS; exists(irFunctionsFile))
+      irFunctions = TestUtil::getFileContentLinesVector(irFunctionsFile);
+    bool irOptimized = false;
     for (uint8_t i = 1; i <= 5; i++) {
-      TestUtil::checkRefMatch(testCase.testPath / REF_NAME_OPT_IR[i - 1], [&] {
+      irOptimized |= TestUtil::checkRefMatch(testCase.testPath / REF_NAME_OPT_IR[i - 1], [&] {
         cliOptions.optLevel = static_cast<OptLevel>(i);
 
         if (cliOptions.useLTO) {
@@ -155,10 +172,17 @@ void execTestCase(const TestCase &testCase) {
           mainSourceFile->runDefaultIROptimizer();
         }
 
-        return mainSourceFile->compilerOutput.irOptString;
+        llvm::Module *module = cliOptions.useLTO ? resourceManager.ltoModule.get() : mainSourceFile->llvmModule.get();
+        if (!irFunctions.empty())
+          return TestUtil::getFunctionsIRString(module, irFunctions);
+        return IRGenerator::getIRString(module, true);
       });
     }
 
+    // Optimize the IR at the requested opt level, if no optimized IR ref did that already
+    if (!irOptimized && optLevel > O0 && !cliOptions.useLTO)
+      mainSourceFile->runDefaultIROptimizer();
+
     // Link the bitcode if not happened yet
     if (cliOptions.useLTO && cliOptions.optLevel == O0)
       mainSourceFile->runBitcodeLinker();
@@ -214,8 +238,17 @@ void execTestCase(const TestCase &testCase) {
     // Check if the execution output matches the expected output
     TestUtil::checkRefMatch(testCase.testPath / REF_NAME_EXECUTION_OUTPUT, [&] {
       const std::filesystem::path cliFlagsFile = testCase.testPath / INPUT_NAME_CLI_FLAGS;
+      // Instrumented binaries write their profile to the output dir instead of default_*.profraw in the cwd
+      const std::filesystem::path profilePath = std::filesystem::path(cliOptions.outputDir) / OUTPUT_NAME_PGO_PROFILE;
       // Execute binary
       std::stringstream cmd;
+      if (cliOptions.pgoInstrGen) {
+#if OS_WINDOWS
+        cmd << "set LLVM_PROFILE_FILE=" << profilePath.string() << "&& ";
+#else
+        cmd << "LLVM_PROFILE_FILE=" << profilePath.string() << " ";
+#endif
+      }
       if (enableLeakDetection)
         cmd << "valgrind -q --leak-check=full --num-callers=100 --error-exitcode=1 ";
       cmd << TestUtil::getDefaultExecutableName();
@@ -223,6 +256,10 @@ void execTestCase(const TestCase &testCase) {
         cmd << " " << TestUtil::getFileContentLinesVector(cliFlagsFile).at(0);
       const auto [output, exitCode] = FileUtil::exec(cmd.str(), true);
 
+      // Make sure, that the profile was written and clean it up
+      if (cliOptions.pgoInstrGen)
+        EXPECT_TRUE(std::filesystem::remove(profilePath)) << "Instrumented binary did not write a profile";
+
 #if not OS_WINDOWS // Windows does not give us the exit code, so we cannot check it on Windows
       // Check if the exit code matches the expected one
       // If no exit code ref file exists, check against 0
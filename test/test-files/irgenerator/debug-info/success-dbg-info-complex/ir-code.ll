@@ -1,7 +1,7 @@
 ; ModuleID = 'source.spice'
 source_filename = "source.spice"
 
-%struct.Vector = type { %interface.IIterable, ptr, i64, i64 }
+%struct.Vector = type { %interface.IIterable, ptr, i64, i64, i32, ptr }
 %interface.IIterable = type { ptr }
 %struct.VectorIterator = type { %interface.IIterator, ptr, i64 }
 %interface.IIterator = type { ptr }
@@ -63,380 +63,376 @@ define dso_local i32 @main(i32 %0, ptr %1) #0 !dbg !14 {
   store i32 %0, ptr %_argc, align 4, !dbg !23
     #dbg_declare(ptr %_argv, !25, !DIExpression(), !23)
   store ptr %1, ptr %_argv, align 8, !dbg !23
-    #dbg_declare(ptr %vi, !26, !DIExpression(), !34)
-  call void @_ZN6VectorIiE4ctorEv(ptr noundef nonnull align 8 dereferenceable(32) %vi), !dbg !35
-  store i32 123, ptr %3, align 4, !dbg !36
-  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(32) %vi, ptr %3), !dbg !36
-  store i32 4321, ptr %4, align 4, !dbg !37
-  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(32) %vi, ptr %4), !dbg !37
-  store i32 9876, ptr %5, align 4, !dbg !38
-  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(32) %vi, ptr %5), !dbg !38
-  %13 = call i64 @_ZN6VectorIiE7getSizeEv(ptr noundef nonnull align 8 dereferenceable(32) %vi), !dbg !39
-  %14 = icmp eq i64 %13, 3, !dbg !40
-  br i1 %14, label %assert.exit.L10, label %assert.then.L10, !dbg !40, !prof !41
+    #dbg_declare(ptr %vi, !26, !DIExpression(), !69)
+  call void @_ZN6VectorIiE4ctorEv(ptr noundef nonnull align 8 dereferenceable(48) %vi), !dbg !70
+  store i32 123, ptr %3, align 4, !dbg !71
+  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(48) %vi, ptr %3), !dbg !71
+  store i32 4321, ptr %4, align 4, !dbg !72
+  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(48) %vi, ptr %4), !dbg !72
+  store i32 9876, ptr %5, align 4, !dbg !73
+  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(48) %vi, ptr %5), !dbg !73
+  %13 = call i64 @_ZN6VectorIiE7getSizeEv(ptr noundef nonnull align 8 dereferenceable(48) %vi), !dbg !74
+  %14 = icmp eq i64 %13, 3, !dbg !75
+  br i1 %14, label %assert.exit.L10, label %assert.then.L10, !dbg !75, !prof !76
 
 assert.then.L10:                                  ; preds = %2
-  %15 = call i32 (ptr, ...) @printf(ptr @anon.string.0), !dbg !40
-  call void @exit(i32 1), !dbg !40
-  unreachable, !dbg !40
+  %15 = call i32 (ptr, ...) @printf(ptr @anon.string.0), !dbg !75
+  call void @exit(i32 1), !dbg !75
+  unreachable, !dbg !75
 
 assert.exit.L10:                                  ; preds = %2
-  %16 = call %struct.VectorIterator @_ZN6VectorIiE11getIteratorEv(ptr noundef nonnull align 8 dereferenceable(32) %vi), !dbg !42
-    #dbg_declare(ptr %it, !43, !DIExpression(), !49)
-  store %struct.VectorIterator %16, ptr %it, align 8, !dbg !42
-  %17 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !50
-  br i1 %17, label %assert.exit.L14, label %assert.then.L14, !dbg !50, !prof !41
+    #dbg_declare(ptr %it, !78, !DIExpression(), !84)
+  call void @_ZN6VectorIiE11getIteratorEv(ptr noundef nonnull align 8 dereferenceable(48) %vi, ptr sret(%struct.VectorIterator) %it), !dbg !77
+  %16 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !85
+  br i1 %16, label %assert.exit.L14, label %assert.then.L14, !dbg !85, !prof !76
 
 assert.then.L14:                                  ; preds = %assert.exit.L10
-  %18 = call i32 (ptr, ...) @printf(ptr @anon.string.1), !dbg !50
-  call void @exit(i32 1), !dbg !50
-  unreachable, !dbg !50
+  %17 = call i32 (ptr, ...) @printf(ptr @anon.string.1), !dbg !85
+  call void @exit(i32 1), !dbg !85
+  unreachable, !dbg !85
 
 assert.exit.L14:                                  ; preds = %assert.exit.L10
-  %19 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !51
-  %20 = load i32, ptr %19, align 4, !dbg !52
-  %21 = icmp eq i32 %20, 123, !dbg !52
-  br i1 %21, label %assert.exit.L15, label %assert.then.L15, !dbg !52, !prof !41
+  %18 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !86
+  %19 = load i32, ptr %18, align 4, !dbg !87
+  %20 = icmp eq i32 %19, 123, !dbg !87
+  br i1 %20, label %assert.exit.L15, label %assert.then.L15, !dbg !87, !prof !76
 
 assert.then.L15:                                  ; preds = %assert.exit.L14
-  %22 = call i32 (ptr, ...) @printf(ptr @anon.string.2), !dbg !52
-  call void @exit(i32 1), !dbg !52
-  unreachable, !dbg !52
+  %21 = call i32 (ptr, ...) @printf(ptr @anon.string.2), !dbg !87
+  call void @exit(i32 1), !dbg !87
+  unreachable, !dbg !87
 
 assert.exit.L15:                                  ; preds = %assert.exit.L14
-  %23 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !53
-  %24 = load i32, ptr %23, align 4, !dbg !54
-  %25 = icmp eq i32 %24, 123, !dbg !54
-  br i1 %25, label %assert.exit.L16, label %assert.then.L16, !dbg !54, !prof !41
+  %22 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !88
+  %23 = load i32, ptr %22, align 4, !dbg !89
+  %24 = icmp eq i32 %23, 123, !dbg !89
+  br i1 %24, label %assert.exit.L16, label %assert.then.L16, !dbg !89, !prof !76
 
 assert.then.L16:                                  ; preds = %assert.exit.L15
-  %26 = call i32 (ptr, ...) @printf(ptr @anon.string.3), !dbg !54
-  call void @exit(i32 1), !dbg !54
-  unreachable, !dbg !54
+  %25 = call i32 (ptr, ...) @printf(ptr @anon.string.3), !dbg !89
+  call void @exit(i32 1), !dbg !89
+  unreachable, !dbg !89
 
 assert.exit.L16:                                  ; preds = %assert.exit.L15
-  call void @_ZN14VectorIteratorIiE4nextEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !55
-  %27 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !56
-  %28 = load i32, ptr %27, align 4, !dbg !57
-  %29 = icmp eq i32 %28, 4321, !dbg !57
-  br i1 %29, label %assert.exit.L18, label %assert.then.L18, !dbg !57, !prof !41
+  call void @_ZN14VectorIteratorIiE4nextEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !90
+  %26 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !91
+  %27 = load i32, ptr %26, align 4, !dbg !92
+  %28 = icmp eq i32 %27, 4321, !dbg !92
+  br i1 %28, label %assert.exit.L18, label %assert.then.L18, !dbg !92, !prof !76
 
 assert.then.L18:                                  ; preds = %assert.exit.L16
-  %30 = call i32 (ptr, ...) @printf(ptr @anon.string.4), !dbg !57
-  call void @exit(i32 1), !dbg !57
-  unreachable, !dbg !57
+  %29 = call i32 (ptr, ...) @printf(ptr @anon.string.4), !dbg !92
+  call void @exit(i32 1), !dbg !92
+  unreachable, !dbg !92
 
 assert.exit.L18:                                  ; preds = %assert.exit.L16
-  %31 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !58
-  br i1 %31, label %assert.exit.L19, label %assert.then.L19, !dbg !58, !prof !41
+  %30 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !93
+  br i1 %30, label %assert.exit.L19, label %assert.then.L19, !dbg !93, !prof !76
 
 assert.then.L19:                                  ; preds = %assert.exit.L18
-  %32 = call i32 (ptr, ...) @printf(ptr @anon.string.5), !dbg !58
-  call void @exit(i32 1), !dbg !58
-  unreachable, !dbg !58
+  %31 = call i32 (ptr, ...) @printf(ptr @anon.string.5), !dbg !93
+  call void @exit(i32 1), !dbg !93
+  unreachable, !dbg !93
 
 assert.exit.L19:                                  ; preds = %assert.exit.L18
-  call void @_ZN14VectorIteratorIiE4nextEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !59
-  %33 = call %struct.Pair @_ZN14VectorIteratorIiE6getIdxEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !60
-    #dbg_declare(ptr %pair, !61, !DIExpression(), !67)
-  store %struct.Pair %33, ptr %pair, align 8, !dbg !60
-  %34 = call ptr @_ZN4PairImRiE8getFirstEv(ptr noundef nonnull align 8 dereferenceable(16) %pair), !dbg !68
-  %35 = load i64, ptr %34, align 8, !dbg !69
-  %36 = icmp eq i64 %35, 2, !dbg !69
-  br i1 %36, label %assert.exit.L22, label %assert.then.L22, !dbg !69, !prof !41
+  call void @_ZN14VectorIteratorIiE4nextEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !94
+  %32 = call %struct.Pair @_ZN14VectorIteratorIiE6getIdxEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !95
+    #dbg_declare(ptr %pair, !96, !DIExpression(), !102)
+  store %struct.Pair %32, ptr %pair, align 8, !dbg !95
+  %33 = call ptr @_ZN4PairImRiE8getFirstEv(ptr noundef nonnull align 8 dereferenceable(16) %pair), !dbg !103
+  %34 = load i64, ptr %33, align 8, !dbg !104
+  %35 = icmp eq i64 %34, 2, !dbg !104
+  br i1 %35, label %assert.exit.L22, label %assert.then.L22, !dbg !104, !prof !76
 
 assert.then.L22:                                  ; preds = %assert.exit.L19
-  %37 = call i32 (ptr, ...) @printf(ptr @anon.string.6), !dbg !69
-  call void @exit(i32 1), !dbg !69
-  unreachable, !dbg !69
+  %36 = call i32 (ptr, ...) @printf(ptr @anon.string.6), !dbg !104
+  call void @exit(i32 1), !dbg !104
+  unreachable, !dbg !104
 
 assert.exit.L22:                                  ; preds = %assert.exit.L19
-  %38 = call ptr @_ZN4PairImRiE9getSecondEv(ptr noundef nonnull align 8 dereferenceable(16) %pair), !dbg !70
-  %39 = load i32, ptr %38, align 4, !dbg !71
-  %40 = icmp eq i32 %39, 9876, !dbg !71
-  br i1 %40, label %assert.exit.L23, label %assert.then.L23, !dbg !71, !prof !41
+  %37 = call ptr @_ZN4PairImRiE9getSecondEv(ptr noundef nonnull align 8 dereferenceable(16) %pair), !dbg !105
+  %38 = load i32, ptr %37, align 4, !dbg !106
+  %39 = icmp eq i32 %38, 9876, !dbg !106
+  br i1 %39, label %assert.exit.L23, label %assert.then.L23, !dbg !106, !prof !76
 
 assert.then.L23:                                  ; preds = %assert.exit.L22
-  %41 = call i32 (ptr, ...) @printf(ptr @anon.string.7), !dbg !71
-  call void @exit(i32 1), !dbg !71
-  unreachable, !dbg !71
+  %40 = call i32 (ptr, ...) @printf(ptr @anon.string.7), !dbg !106
+  call void @exit(i32 1), !dbg !106
+  unreachable, !dbg !106
 
 assert.exit.L23:                                  ; preds = %assert.exit.L22
-  call void @_ZN14VectorIteratorIiE4nextEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !72
-  %42 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !73
-  %43 = xor i1 %42, true, !dbg !73
-  br i1 %43, label %assert.exit.L25, label %assert.then.L25, !dbg !73, !prof !41
+  call void @_ZN14VectorIteratorIiE4nextEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !107
+  %41 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !108
+  %42 = xor i1 %41, true, !dbg !108
+  br i1 %42, label %assert.exit.L25, label %assert.then.L25, !dbg !108, !prof !76
 
 assert.then.L25:                                  ; preds = %assert.exit.L23
-  %44 = call i32 (ptr, ...) @printf(ptr @anon.string.8), !dbg !73
-  call void @exit(i32 1), !dbg !73
-  unreachable, !dbg !73
+  %43 = call i32 (ptr, ...) @printf(ptr @anon.string.8), !dbg !108
+  call void @exit(i32 1), !dbg !108
+  unreachable, !dbg !108
 
 assert.exit.L25:                                  ; preds = %assert.exit.L23
-  store i32 321, ptr %6, align 4, !dbg !74
-  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(32) %vi, ptr %6), !dbg !74
-  store i32 -99, ptr %7, align 4, !dbg !75
-  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(32) %vi, ptr %7), !dbg !75
-  %45 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !76
-  br i1 %45, label %assert.exit.L30, label %assert.then.L30, !dbg !76, !prof !41
+  store i32 321, ptr %6, align 4, !dbg !109
+  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(48) %vi, ptr %6), !dbg !109
+  store i32 -99, ptr %7, align 4, !dbg !110
+  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(48) %vi, ptr %7), !dbg !110
+  %44 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !111
+  br i1 %44, label %assert.exit.L30, label %assert.then.L30, !dbg !111, !prof !76
 
 assert.then.L30:                                  ; preds = %assert.exit.L25
-  %46 = call i32 (ptr, ...) @printf(ptr @anon.string.9), !dbg !76
-  call void @exit(i32 1), !dbg !76
-  unreachable, !dbg !76
+  %45 = call i32 (ptr, ...) @printf(ptr @anon.string.9), !dbg !111
+  call void @exit(i32 1), !dbg !111
+  unreachable, !dbg !111
 
 assert.exit.L30:                                  ; preds = %assert.exit.L25
-  call void @_Z13op.minusequalIiiEvR14VectorIteratorIiEi(ptr %it, i32 3), !dbg !77
-  %47 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !78
-  %48 = load i32, ptr %47, align 4, !dbg !79
-  %49 = icmp eq i32 %48, 123, !dbg !79
-  br i1 %49, label %assert.exit.L34, label %assert.then.L34, !dbg !79, !prof !41
+  call void @_Z13op.minusequalIiiEvR14VectorIteratorIiEi(ptr %it, i32 3), !dbg !112
+  %46 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !113
+  %47 = load i32, ptr %46, align 4, !dbg !114
+  %48 = icmp eq i32 %47, 123, !dbg !114
+  br i1 %48, label %assert.exit.L34, label %assert.then.L34, !dbg !114, !prof !76
 
 assert.then.L34:                                  ; preds = %assert.exit.L30
-  %50 = call i32 (ptr, ...) @printf(ptr @anon.string.10), !dbg !79
-  call void @exit(i32 1), !dbg !79
-  unreachable, !dbg !79
+  %49 = call i32 (ptr, ...) @printf(ptr @anon.string.10), !dbg !114
+  call void @exit(i32 1), !dbg !114
+  unreachable, !dbg !114
 
 assert.exit.L34:                                  ; preds = %assert.exit.L30
-  %51 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !80
-  br i1 %51, label %assert.exit.L35, label %assert.then.L35, !dbg !80, !prof !41
+  %50 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !115
+  br i1 %50, label %assert.exit.L35, label %assert.then.L35, !dbg !115, !prof !76
 
 assert.then.L35:                                  ; preds = %assert.exit.L34
-  %52 = call i32 (ptr, ...) @printf(ptr @anon.string.11), !dbg !80
-  call void @exit(i32 1), !dbg !80
-  unreachable, !dbg !80
+  %51 = call i32 (ptr, ...) @printf(ptr @anon.string.11), !dbg !115
+  call void @exit(i32 1), !dbg !115
+  unreachable, !dbg !115
 
 assert.exit.L35:                                  ; preds = %assert.exit.L34
-  %53 = load %struct.VectorIterator, ptr %it, align 8, !dbg !81
-  call void @_Z16op.plusplus.postIiEvR14VectorIteratorIiE(ptr %it), !dbg !81
-  %54 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !82
-  %55 = load i32, ptr %54, align 4, !dbg !83
-  %56 = icmp eq i32 %55, 4321, !dbg !83
-  br i1 %56, label %assert.exit.L37, label %assert.then.L37, !dbg !83, !prof !41
+  %52 = load %struct.VectorIterator, ptr %it, align 8, !dbg !116
+  call void @_Z16op.plusplus.postIiEvR14VectorIteratorIiE(ptr %it), !dbg !116
+  %53 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !117
+  %54 = load i32, ptr %53, align 4, !dbg !118
+  %55 = icmp eq i32 %54, 4321, !dbg !118
+  br i1 %55, label %assert.exit.L37, label %assert.then.L37, !dbg !118, !prof !76
 
 assert.then.L37:                                  ; preds = %assert.exit.L35
-  %57 = call i32 (ptr, ...) @printf(ptr @anon.string.12), !dbg !83
-  call void @exit(i32 1), !dbg !83
-  unreachable, !dbg !83
+  %56 = call i32 (ptr, ...) @printf(ptr @anon.string.12), !dbg !118
+  call void @exit(i32 1), !dbg !118
+  unreachable, !dbg !118
 
 assert.exit.L37:                                  ; preds = %assert.exit.L35
-  %58 = load %struct.VectorIterator, ptr %it, align 8, !dbg !84
-  call void @_Z18op.minusminus.postIiEvR14VectorIteratorIiE(ptr %it), !dbg !84
-  %59 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !85
-  %60 = load i32, ptr %59, align 4, !dbg !86
-  %61 = icmp eq i32 %60, 123, !dbg !86
-  br i1 %61, label %assert.exit.L39, label %assert.then.L39, !dbg !86, !prof !41
+  %57 = load %struct.VectorIterator, ptr %it, align 8, !dbg !119
+  call void @_Z18op.minusminus.postIiEvR14VectorIteratorIiE(ptr %it), !dbg !119
+  %58 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !120
+  %59 = load i32, ptr %58, align 4, !dbg !121
+  %60 = icmp eq i32 %59, 123, !dbg !121
+  br i1 %60, label %assert.exit.L39, label %assert.then.L39, !dbg !121, !prof !76
 
 assert.then.L39:                                  ; preds = %assert.exit.L37
-  %62 = call i32 (ptr, ...) @printf(ptr @anon.string.13), !dbg !86
-  call void @exit(i32 1), !dbg !86
-  unreachable, !dbg !86
+  %61 = call i32 (ptr, ...) @printf(ptr @anon.string.13), !dbg !121
+  call void @exit(i32 1), !dbg !121
+  unreachable, !dbg !121
 
 assert.exit.L39:                                  ; preds = %assert.exit.L37
-  call void @_Z12op.plusequalIiiEvR14VectorIteratorIiEi(ptr %it, i32 4), !dbg !87
-  %63 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !88
-  %64 = load i32, ptr %63, align 4, !dbg !89
-  %65 = icmp eq i32 %64, -99, !dbg !89
-  br i1 %65, label %assert.exit.L41, label %assert.then.L41, !dbg !89, !prof !41
+  call void @_Z12op.plusequalIiiEvR14VectorIteratorIiEi(ptr %it, i32 4), !dbg !122
+  %62 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !123
+  %63 = load i32, ptr %62, align 4, !dbg !124
+  %64 = icmp eq i32 %63, -99, !dbg !124
+  br i1 %64, label %assert.exit.L41, label %assert.then.L41, !dbg !124, !prof !76
 
 assert.then.L41:                                  ; preds = %assert.exit.L39
-  %66 = call i32 (ptr, ...) @printf(ptr @anon.string.14), !dbg !89
-  call void @exit(i32 1), !dbg !89
-  unreachable, !dbg !89
+  %65 = call i32 (ptr, ...) @printf(ptr @anon.string.14), !dbg !124
+  call void @exit(i32 1), !dbg !124
+  unreachable, !dbg !124
 
 assert.exit.L41:                                  ; preds = %assert.exit.L39
-  call void @_ZN14VectorIteratorIiE4nextEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !90
-  %67 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !91
-  %68 = xor i1 %67, true, !dbg !91
-  br i1 %68, label %assert.exit.L43, label %assert.then.L43, !dbg !91, !prof !41
+  call void @_ZN14VectorIteratorIiE4nextEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !125
+  %66 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr noundef nonnull align 8 dereferenceable(24) %it), !dbg !126
+  %67 = xor i1 %66, true, !dbg !126
+  br i1 %67, label %assert.exit.L43, label %assert.then.L43, !dbg !126, !prof !76
 
 assert.then.L43:                                  ; preds = %assert.exit.L41
-  %69 = call i32 (ptr, ...) @printf(ptr @anon.string.15), !dbg !91
-  call void @exit(i32 1), !dbg !91
-  unreachable, !dbg !91
+  %68 = call i32 (ptr, ...) @printf(ptr @anon.string.15), !dbg !126
+  call void @exit(i32 1), !dbg !126
+  unreachable, !dbg !126
 
 assert.exit.L43:                                  ; preds = %assert.exit.L41
-  %70 = call %struct.VectorIterator @_ZN6VectorIiE11getIteratorEv(ptr noundef nonnull align 8 dereferenceable(32) %vi), !dbg !92
-    #dbg_declare(ptr %item, !94, !DIExpression(), !95)
-  store %struct.VectorIterator %70, ptr %8, align 8, !dbg !92
-  br label %foreach.head.L46, !dbg !95
+    #dbg_declare(ptr %item, !129, !DIExpression(), !130)
+  call void @_ZN6VectorIiE11getIteratorEv(ptr noundef nonnull align 8 dereferenceable(48) %vi, ptr sret(%struct.VectorIterator) %8), !dbg !127
+  br label %foreach.head.L46, !dbg !130
 
 foreach.head.L46:                                 ; preds = %foreach.tail.L46, %assert.exit.L43
-  %71 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr %8), !dbg !95
-  br i1 %71, label %foreach.body.L46, label %foreach.exit.L46, !dbg !95
+  %69 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr %8), !dbg !130
+  br i1 %69, label %foreach.body.L46, label %foreach.exit.L46, !dbg !130
 
 foreach.body.L46:                                 ; preds = %foreach.head.L46
-  %72 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr %8), !dbg !95
-  %73 = load i32, ptr %72, align 4, !dbg !95
-  store i32 %73, ptr %item, align 4, !dbg !95
-  %74 = load i32, ptr %item, align 4, !dbg !96
-  %75 = add nsw i32 %74, 1, !dbg !96
-  store i32 %75, ptr %item, align 4, !dbg !96
-  br label %foreach.tail.L46, !dbg !97
+  %70 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr %8), !dbg !130
+  %71 = load i32, ptr %70, align 4, !dbg !130
+  store i32 %71, ptr %item, align 4, !dbg !130
+  %72 = load i32, ptr %item, align 4, !dbg !131
+  %73 = add nsw i32 %72, 1, !dbg !131
+  store i32 %73, ptr %item, align 4, !dbg !131
+  br label %foreach.tail.L46, !dbg !132
 
 foreach.tail.L46:                                 ; preds = %foreach.body.L46
-  call void @_ZN14VectorIteratorIiE4nextEv(ptr %8), !dbg !97
-  br label %foreach.head.L46, !dbg !97
+  call void @_ZN14VectorIteratorIiE4nextEv(ptr %8), !dbg !132
+  br label %foreach.head.L46, !dbg !132
 
 foreach.exit.L46:                                 ; preds = %foreach.head.L46
-  %76 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(32) %vi, i32 0), !dbg !98
-  %77 = load i32, ptr %76, align 4, !dbg !99
-  %78 = icmp eq i32 %77, 123, !dbg !99
-  br i1 %78, label %assert.exit.L49, label %assert.then.L49, !dbg !99, !prof !41
+  %74 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(48) %vi, i32 0), !dbg !133
+  %75 = load i32, ptr %74, align 4, !dbg !134
+  %76 = icmp eq i32 %75, 123, !dbg !134
+  br i1 %76, label %assert.exit.L49, label %assert.then.L49, !dbg !134, !prof !76
 
 assert.then.L49:                                  ; preds = %foreach.exit.L46
-  %79 = call i32 (ptr, ...) @printf(ptr @anon.string.16), !dbg !99
-  call void @exit(i32 1), !dbg !99
-  unreachable, !dbg !99
+  %77 = call i32 (ptr, ...) @printf(ptr @anon.string.16), !dbg !134
+  call void @exit(i32 1), !dbg !134
+  unreachable, !dbg !134
 
 assert.exit.L49:                                  ; preds = %foreach.exit.L46
-  %80 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(32) %vi, i32 1), !dbg !100
-  %81 = load i32, ptr %80, align 4, !dbg !101
-  %82 = icmp eq i32 %81, 4321, !dbg !101
-  br i1 %82, label %assert.exit.L50, label %assert.then.L50, !dbg !101, !prof !41
+  %78 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(48) %vi, i32 1), !dbg !135
+  %79 = load i32, ptr %78, align 4, !dbg !136
+  %80 = icmp eq i32 %79, 4321, !dbg !136
+  br i1 %80, label %assert.exit.L50, label %assert.then.L50, !dbg !136, !prof !76
 
 assert.then.L50:                                  ; preds = %assert.exit.L49
-  %83 = call i32 (ptr, ...) @printf(ptr @anon.string.17), !dbg !101
-  call void @exit(i32 1), !dbg !101
-  unreachable, !dbg !101
+  %81 = call i32 (ptr, ...) @printf(ptr @anon.string.17), !dbg !136
+  call void @exit(i32 1), !dbg !136
+  unreachable, !dbg !136
 
 assert.exit.L50:                                  ; preds = %assert.exit.L49
-  %84 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(32) %vi, i32 2), !dbg !102
-  %85 = load i32, ptr %84, align 4, !dbg !103
-  %86 = icmp eq i32 %85, 9876, !dbg !103
-  br i1 %86, label %assert.exit.L51, label %assert.then.L51, !dbg !103, !prof !41
+  %82 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(48) %vi, i32 2), !dbg !137
+  %83 = load i32, ptr %82, align 4, !dbg !138
+  %84 = icmp eq i32 %83, 9876, !dbg !138
+  br i1 %84, label %assert.exit.L51, label %assert.then.L51, !dbg !138, !prof !76
 
 assert.then.L51:                                  ; preds = %assert.exit.L50
-  %87 = call i32 (ptr, ...) @printf(ptr @anon.string.18), !dbg !103
-  call void @exit(i32 1), !dbg !103
-  unreachable, !dbg !103
+  %85 = call i32 (ptr, ...) @printf(ptr @anon.string.18), !dbg !138
+  call void @exit(i32 1), !dbg !138
+  unreachable, !dbg !138
 
 assert.exit.L51:                                  ; preds = %assert.exit.L50
-  %88 = call %struct.VectorIterator @_ZN6VectorIiE11getIteratorEv(ptr noundef nonnull align 8 dereferenceable(32) %vi), !dbg !104
-    #dbg_declare(ptr %item1, !106, !DIExpression(), !107)
-  store %struct.VectorIterator %88, ptr %9, align 8, !dbg !104
-  br label %foreach.head.L54, !dbg !107
+    #dbg_declare(ptr %item1, !141, !DIExpression(), !142)
+  call void @_ZN6VectorIiE11getIteratorEv(ptr noundef nonnull align 8 dereferenceable(48) %vi, ptr sret(%struct.VectorIterator) %9), !dbg !139
+  br label %foreach.head.L54, !dbg !142
 
 foreach.head.L54:                                 ; preds = %foreach.tail.L54, %assert.exit.L51
-  %89 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr %9), !dbg !107
-  br i1 %89, label %foreach.body.L54, label %foreach.exit.L54, !dbg !107
+  %86 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr %9), !dbg !142
+  br i1 %86, label %foreach.body.L54, label %foreach.exit.L54, !dbg !142
 
 foreach.body.L54:                                 ; preds = %foreach.head.L54
-  %90 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr %9), !dbg !107
-  store ptr %90, ptr %10, align 8, !dbg !107
-  %91 = load ptr, ptr %10, align 8, !dbg !108
-  %92 = load i32, ptr %91, align 4, !dbg !108
-  %93 = add nsw i32 %92, 1, !dbg !108
-  store i32 %93, ptr %91, align 4, !dbg !108
-  br label %foreach.tail.L54, !dbg !109
+  %87 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr %9), !dbg !142
+  store ptr %87, ptr %10, align 8, !dbg !142
+  %88 = load ptr, ptr %10, align 8, !dbg !143
+  %89 = load i32, ptr %88, align 4, !dbg !143
+  %90 = add nsw i32 %89, 1, !dbg !143
+  store i32 %90, ptr %88, align 4, !dbg !143
+  br label %foreach.tail.L54, !dbg !144
 
 foreach.tail.L54:                                 ; preds = %foreach.body.L54
-  call void @_ZN14VectorIteratorIiE4nextEv(ptr %9), !dbg !109
-  br label %foreach.head.L54, !dbg !109
+  call void @_ZN14VectorIteratorIiE4nextEv(ptr %9), !dbg !144
+  br label %foreach.head.L54, !dbg !144
 
 foreach.exit.L54:                                 ; preds = %foreach.head.L54
-  %94 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(32) %vi, i32 0), !dbg !110
-  %95 = load i32, ptr %94, align 4, !dbg !111
-  %96 = icmp eq i32 %95, 124, !dbg !111
-  br i1 %96, label %assert.exit.L57, label %assert.then.L57, !dbg !111, !prof !41
+  %91 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(48) %vi, i32 0), !dbg !145
+  %92 = load i32, ptr %91, align 4, !dbg !146
+  %93 = icmp eq i32 %92, 124, !dbg !146
+  br i1 %93, label %assert.exit.L57, label %assert.then.L57, !dbg !146, !prof !76
 
 assert.then.L57:                                  ; preds = %foreach.exit.L54
-  %97 = call i32 (ptr, ...) @printf(ptr @anon.string.19), !dbg !111
-  call void @exit(i32 1), !dbg !111
-  unreachable, !dbg !111
+  %94 = call i32 (ptr, ...) @printf(ptr @anon.string.19), !dbg !146
+  call void @exit(i32 1), !dbg !146
+  unreachable, !dbg !146
 
 assert.exit.L57:                                  ; preds = %foreach.exit.L54
-  %98 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(32) %vi, i32 1), !dbg !112
-  %99 = load i32, ptr %98, align 4, !dbg !113
-  %100 = icmp eq i32 %99, 4322, !dbg !113
-  br i1 %100, label %assert.exit.L58, label %assert.then.L58, !dbg !113, !prof !41
+  %95 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(48) %vi, i32 1), !dbg !147
+  %96 = load i32, ptr %95, align 4, !dbg !148
+  %97 = icmp eq i32 %96, 4322, !dbg !148
+  br i1 %97, label %assert.exit.L58, label %assert.then.L58, !dbg !148, !prof !76
 
 assert.then.L58:                                  ; preds = %assert.exit.L57
-  %101 = call i32 (ptr, ...) @printf(ptr @anon.string.20), !dbg !113
-  call void @exit(i32 1), !dbg !113
-  unreachable, !dbg !113
+  %98 = call i32 (ptr, ...) @printf(ptr @anon.string.20), !dbg !148
+  call void @exit(i32 1), !dbg !148
+  unreachable, !dbg !148
 
 assert.exit.L58:                                  ; preds = %assert.exit.L57
-  %102 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(32) %vi, i32 2), !dbg !114
-  %103 = load i32, ptr %102, align 4, !dbg !115
-  %104 = icmp eq i32 %103, 9877, !dbg !115
-  br i1 %104, label %assert.exit.L59, label %assert.then.L59, !dbg !115, !prof !41
+  %99 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(48) %vi, i32 2), !dbg !149
+  %100 = load i32, ptr %99, align 4, !dbg !150
+  %101 = icmp eq i32 %100, 9877, !dbg !150
+  br i1 %101, label %assert.exit.L59, label %assert.then.L59, !dbg !150, !prof !76
 
 assert.then.L59:                                  ; preds = %assert.exit.L58
-  %105 = call i32 (ptr, ...) @printf(ptr @anon.string.21), !dbg !115
-  call void @exit(i32 1), !dbg !115
-  unreachable, !dbg !115
+  %102 = call i32 (ptr, ...) @printf(ptr @anon.string.21), !dbg !150
+  call void @exit(i32 1), !dbg !150
+  unreachable, !dbg !150
 
 assert.exit.L59:                                  ; preds = %assert.exit.L58
-  %106 = call %struct.VectorIterator @_ZN6VectorIiE11getIteratorEv(ptr noundef nonnull align 8 dereferenceable(32) %vi), !dbg !116
-  store %struct.VectorIterator %106, ptr %11, align 8, !dbg !116
-    #dbg_declare(ptr %idx, !118, !DIExpression(), !120)
-    #dbg_declare(ptr %item2, !121, !DIExpression(), !122)
-  store i64 0, ptr %idx, align 8, !dbg !120
-  br label %foreach.head.L61, !dbg !122
+  call void @_ZN6VectorIiE11getIteratorEv(ptr noundef nonnull align 8 dereferenceable(48) %vi, ptr sret(%struct.VectorIterator) %11), !dbg !151
+    #dbg_declare(ptr %idx, !153, !DIExpression(), !155)
+    #dbg_declare(ptr %item2, !156, !DIExpression(), !157)
+  store i64 0, ptr %idx, align 8, !dbg !155
+  br label %foreach.head.L61, !dbg !157
 
 foreach.head.L61:                                 ; preds = %foreach.tail.L61, %assert.exit.L59
-  %107 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr %11), !dbg !122
-  br i1 %107, label %foreach.body.L61, label %foreach.exit.L61, !dbg !122
+  %103 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr %11), !dbg !157
+  br i1 %103, label %foreach.body.L61, label %foreach.exit.L61, !dbg !157
 
 foreach.body.L61:                                 ; preds = %foreach.head.L61
-  %pair3 = call %struct.Pair @_ZN14VectorIteratorIiE6getIdxEv(ptr %11), !dbg !122
-  store %struct.Pair %pair3, ptr %pair_addr, align 8, !dbg !122
-  %108 = load i64, ptr %pair_addr, align 8, !dbg !122
-  store i64 %108, ptr %idx, align 8, !dbg !122
-  %item_addr = getelementptr inbounds nuw %struct.Pair, ptr %pair_addr, i32 0, i32 1, !dbg !122
-  %109 = load ptr, ptr %item_addr, align 8, !dbg !122
-  store ptr %109, ptr %12, align 8, !dbg !122
-  %110 = load i64, ptr %idx, align 8, !dbg !123
-  %111 = trunc i64 %110 to i32, !dbg !123
-  %112 = load ptr, ptr %12, align 8, !dbg !123
-  %113 = load i32, ptr %112, align 4, !dbg !123
-  %114 = add nsw i32 %113, %111, !dbg !123
-  store i32 %114, ptr %112, align 4, !dbg !123
-  br label %foreach.tail.L61, !dbg !124
+  %pair3 = call %struct.Pair @_ZN14VectorIteratorIiE6getIdxEv(ptr %11), !dbg !157
+  store %struct.Pair %pair3, ptr %pair_addr, align 8, !dbg !157
+  %104 = load i64, ptr %pair_addr, align 8, !dbg !157
+  store i64 %104, ptr %idx, align 8, !dbg !157
+  %item_addr = getelementptr inbounds nuw %struct.Pair, ptr %pair_addr, i32 0, i32 1, !dbg !157
+  %105 = load ptr, ptr %item_addr, align 8, !dbg !157
+  store ptr %105, ptr %12, align 8, !dbg !157
+  %106 = load i64, ptr %idx, align 8, !dbg !158
+  %107 = trunc i64 %106 to i32, !dbg !158
+  %108 = load ptr, ptr %12, align 8, !dbg !158
+  %109 = load i32, ptr %108, align 4, !dbg !158
+  %110 = add nsw i32 %109, %107, !dbg !158
+  store i32 %110, ptr %108, align 4, !dbg !158
+  br label %foreach.tail.L61, !dbg !159
 
 foreach.tail.L61:                                 ; preds = %foreach.body.L61
-  call void @_ZN14VectorIteratorIiE4nextEv(ptr %11), !dbg !124
-  br label %foreach.head.L61, !dbg !124
+  call void @_ZN14VectorIteratorIiE4nextEv(ptr %11), !dbg !159
+  br label %foreach.head.L61, !dbg !159
 
 foreach.exit.L61:                                 ; preds = %foreach.head.L61
-  %115 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(32) %vi, i32 0), !dbg !125
-  %116 = load i32, ptr %115, align 4, !dbg !126
-  %117 = icmp eq i32 %116, 124, !dbg !126
-  br i1 %117, label %assert.exit.L64, label %assert.then.L64, !dbg !126, !prof !41
+  %111 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(48) %vi, i32 0), !dbg !160
+  %112 = load i32, ptr %111, align 4, !dbg !161
+  %113 = icmp eq i32 %112, 124, !dbg !161
+  br i1 %113, label %assert.exit.L64, label %assert.then.L64, !dbg !161, !prof !76
 
 assert.then.L64:                                  ; preds = %foreach.exit.L61
-  %118 = call i32 (ptr, ...) @printf(ptr @anon.string.22), !dbg !126
-  call void @exit(i32 1), !dbg !126
-  unreachable, !dbg !126
+  %114 = call i32 (ptr, ...) @printf(ptr @anon.string.22), !dbg !161
+  call void @exit(i32 1), !dbg !161
+  unreachable, !dbg !161
 
 assert.exit.L64:                                  ; preds = %foreach.exit.L61
-  %119 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(32) %vi, i32 1), !dbg !127
-  %120 = load i32, ptr %119, align 4, !dbg !128
-  %121 = icmp eq i32 %120, 4323, !dbg !128
-  br i1 %121, label %assert.exit.L65, label %assert.then.L65, !dbg !128, !prof !41
+  %115 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(48) %vi, i32 1), !dbg !162
+  %116 = load i32, ptr %115, align 4, !dbg !163
+  %117 = icmp eq i32 %116, 4323, !dbg !163
+  br i1 %117, label %assert.exit.L65, label %assert.then.L65, !dbg !163, !prof !76
 
 assert.then.L65:                                  ; preds = %assert.exit.L64
-  %122 = call i32 (ptr, ...) @printf(ptr @anon.string.23), !dbg !128
-  call void @exit(i32 1), !dbg !128
-  unreachable, !dbg !128
+  %118 = call i32 (ptr, ...) @printf(ptr @anon.string.23), !dbg !163
+  call void @exit(i32 1), !dbg !163
+  unreachable, !dbg !163
 
 assert.exit.L65:                                  ; preds = %assert.exit.L64
-  %123 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(32) %vi, i32 2), !dbg !129
-  %124 = load i32, ptr %123, align 4, !dbg !130
-  %125 = icmp eq i32 %124, 9879, !dbg !130
-  br i1 %125, label %assert.exit.L66, label %assert.then.L66, !dbg !130, !prof !41
+  %119 = call ptr @_ZN6VectorIiE3getEj(ptr noundef nonnull align 8 dereferenceable(48) %vi, i32 2), !dbg !164
+  %120 = load i32, ptr %119, align 4, !dbg !165
+  %121 = icmp eq i32 %120, 9879, !dbg !165
+  br i1 %121, label %assert.exit.L66, label %assert.then.L66, !dbg !165, !prof !76
 
 assert.then.L66:                                  ; preds = %assert.exit.L65
-  %126 = call i32 (ptr, ...) @printf(ptr @anon.string.24), !dbg !130
-  call void @exit(i32 1), !dbg !130
-  unreachable, !dbg !130
+  %122 = call i32 (ptr, ...) @printf(ptr @anon.string.24), !dbg !165
+  call void @exit(i32 1), !dbg !165
+  unreachable, !dbg !165
 
 assert.exit.L66:                                  ; preds = %assert.exit.L65
-  %127 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0), !dbg !131
-  call void @_ZN6VectorIiE4dtorEv(ptr %vi), !dbg !132
-  %128 = load i32, ptr %result, align 4, !dbg !132
-  ret i32 %128, !dbg !132
+  %123 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0), !dbg !166
+  call void @_ZN6VectorIiE4dtorEv(ptr %vi), !dbg !167
+  %124 = load i32, ptr %result, align 4, !dbg !167
+  ret i32 %124, !dbg !167
 }
 
 declare void @_ZN6VectorIiE4ctorEv(ptr)
@@ -451,7 +447,7 @@ declare noundef i32 @printf(ptr nocapture noundef readonly, ...) #1
 ; Function Attrs: cold noreturn nounwind
 declare void @exit(i32) #2
 
-declare %struct.VectorIterator @_ZN6VectorIiE11getIteratorEv(ptr)
+declare void @_ZN6VectorIiE11getIteratorEv(ptr, ptr)
 
 declare i1 @_ZN14VectorIteratorIiE7isValidEv(ptr)
 
@@ -512,109 +508,144 @@ attributes #2 = { cold noreturn nounwind }
 !24 = !DILocalVariable(name: "_argc", arg: 1, scope: !14, file: !5, line: 4, type: !17)
 !25 = !DILocalVariable(name: "_argv", arg: 2, scope: !14, file: !5, line: 4, type: !18)
 !26 = !DILocalVariable(name: "vi", scope: !14, file: !5, line: 6, type: !27)
-!27 = !DICompositeType(tag: DW_TAG_structure_type, name: "Vector", scope: !5, file: !5, line: 25, size: 256, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !28, identifier: "struct.Vector")
-!28 = !{!29, !31, !33}
-!29 = !DIDerivedType(tag: DW_TAG_member, name: "contents", scope: !27, file: !5, line: 26, baseType: !30, size: 64, offset: 64)
+!27 = !DICompositeType(tag: DW_TAG_structure_type, name: "Vector", scope: !5, file: !5, line: 26, size: 384, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !28, identifier: "struct.Vector")
+!28 = !{!29, !31, !33, !34, !36}
+!29 = !DIDerivedType(tag: DW_TAG_member, name: "contents", scope: !27, file: !5, line: 27, baseType: !30, size: 64, offset: 64)
 !30 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !17, size: 64)
-!31 = !DIDerivedType(tag: DW_TAG_member, name: "capacity", scope: !27, file: !5, line: 27, baseType: !32, size: 64, offset: 128)
+!31 = !DIDerivedType(tag: DW_TAG_member, name: "capacity", scope: !27, file: !5, line: 28, baseType: !32, size: 64, offset: 128)
 !32 = !DIBasicType(name: "unsigned long", size: 64, encoding: DW_ATE_unsigned)
-!33 = !DIDerivedType(tag: DW_TAG_member, name: "size", scope: !27, file: !5, line: 28, baseType: !32, size: 64, offset: 192)
-!34 = !DILocation(line: 6, column: 5, scope: !14)
-!35 = !DILocation(line: 6, column: 22, scope: !14)
-!36 = !DILocation(line: 7, column: 17, scope: !14)
-!37 = !DILocation(line: 8, column: 17, scope: !14)
-!38 = !DILocation(line: 9, column: 17, scope: !14)
-!39 = !DILocation(line: 10, column: 12, scope: !14)
-!40 = !DILocation(line: 10, column: 28, scope: !14)
-!41 = !{!"branch_weights", i32 2000, i32 1}
-!42 = !DILocation(line: 13, column: 14, scope: !14)
-!43 = !DILocalVariable(name: "it", scope: !14, file: !5, line: 13, type: !44)
-!44 = !DICompositeType(tag: DW_TAG_structure_type, name: "VectorIterator", scope: !5, file: !5, line: 280, size: 192, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !45, identifier: "struct.VectorIterator")
-!45 = !{!46, !48}
-!46 = !DIDerivedType(tag: DW_TAG_member, name: "vector", scope: !44, file: !5, line: 281, baseType: !47, size: 64, offset: 64)
-!47 = !DIDerivedType(tag: DW_TAG_reference_type, baseType: !27, size: 64)
-!48 = !DIDerivedType(tag: DW_TAG_member, name: "cursor", scope: !44, file: !5, line: 282, baseType: !32, size: 64, offset: 128)
-!49 = !DILocation(line: 13, column: 5, scope: !14)
-!50 = !DILocation(line: 14, column: 12, scope: !14)
-!51 = !DILocation(line: 15, column: 12, scope: !14)
-!52 = !DILocation(line: 15, column: 24, scope: !14)
-!53 = !DILocation(line: 16, column: 12, scope: !14)
-!54 = !DILocation(line: 16, column: 24, scope: !14)
-!55 = !DILocation(line: 17, column: 5, scope: !14)
-!56 = !DILocation(line: 18, column: 12, scope: !14)
-!57 = !DILocation(line: 18, column: 24, scope: !14)
-!58 = !DILocation(line: 19, column: 12, scope: !14)
-!59 = !DILocation(line: 20, column: 5, scope: !14)
-!60 = !DILocation(line: 21, column: 16, scope: !14)
-!61 = !DILocalVariable(name: "pair", scope: !14, file: !5, line: 21, type: !62)
-!62 = !DICompositeType(tag: DW_TAG_structure_type, name: "Pair", scope: !5, file: !5, line: 8, size: 128, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !63, identifier: "struct.Pair")
-!63 = !{!64, !65}
-!64 = !DIDerivedType(tag: DW_TAG_member, name: "first", scope: !62, file: !5, line: 9, baseType: !32, size: 64)
-!65 = !DIDerivedType(tag: DW_TAG_member, name: "second", scope: !62, file: !5, line: 10, baseType: !66, size: 64, offset: 64)
-!66 = !DIDerivedType(tag: DW_TAG_reference_type, baseType: !17, size: 64)
-!67 = !DILocation(line: 21, column: 5, scope: !14)
-!68 = !DILocation(line: 22, column: 12, scope: !14)
-!69 = !DILocation(line: 22, column: 31, scope: !14)
-!70 = !DILocation(line: 23, column: 12, scope: !14)
-!71 = !DILocation(line: 23, column: 32, scope: !14)
-!72 = !DILocation(line: 24, column: 5, scope: !14)
-!73 = !DILocation(line: 25, column: 13, scope: !14)
-!74 = !DILocation(line: 28, column: 17, scope: !14)
-!75 = !DILocation(line: 29, column: 17, scope: !14)
-!76 = !DILocation(line: 30, column: 12, scope: !14)
-!77 = !DILocation(line: 33, column: 5, scope: !14)
-!78 = !DILocation(line: 34, column: 12, scope: !14)
-!79 = !DILocation(line: 34, column: 24, scope: !14)
-!80 = !DILocation(line: 35, column: 12, scope: !14)
-!81 = !DILocation(line: 36, column: 5, scope: !14)
-!82 = !DILocation(line: 37, column: 12, scope: !14)
-!83 = !DILocation(line: 37, column: 24, scope: !14)
-!84 = !DILocation(line: 38, column: 5, scope: !14)
-!85 = !DILocation(line: 39, column: 12, scope: !14)
-!86 = !DILocation(line: 39, column: 24, scope: !14)
-!87 = !DILocation(line: 40, column: 5, scope: !14)
-!88 = !DILocation(line: 41, column: 12, scope: !14)
-!89 = !DILocation(line: 41, column: 24, scope: !14)
-!90 = !DILocation(line: 42, column: 5, scope: !14)
-!91 = !DILocation(line: 43, column: 13, scope: !14)
-!92 = !DILocation(line: 46, column: 24, scope: !93)
-!93 = distinct !DILexicalBlock(scope: !14, file: !5, line: 46, column: 5)
-!94 = !DILocalVariable(name: "item", scope: !93, file: !5, line: 46, type: !17)
-!95 = !DILocation(line: 46, column: 13, scope: !93)
-!96 = !DILocation(line: 47, column: 9, scope: !93)
-!97 = !DILocation(line: 48, column: 5, scope: !93)
-!98 = !DILocation(line: 49, column: 19, scope: !14)
-!99 = !DILocation(line: 49, column: 25, scope: !14)
-!100 = !DILocation(line: 50, column: 19, scope: !14)
-!101 = !DILocation(line: 50, column: 25, scope: !14)
-!102 = !DILocation(line: 51, column: 19, scope: !14)
-!103 = !DILocation(line: 51, column: 25, scope: !14)
-!104 = !DILocation(line: 54, column: 25, scope: !105)
-!105 = distinct !DILexicalBlock(scope: !14, file: !5, line: 54, column: 5)
-!106 = !DILocalVariable(name: "item", scope: !105, file: !5, line: 54, type: !66)
-!107 = !DILocation(line: 54, column: 13, scope: !105)
-!108 = !DILocation(line: 55, column: 9, scope: !105)
-!109 = !DILocation(line: 56, column: 5, scope: !105)
-!110 = !DILocation(line: 57, column: 19, scope: !14)
-!111 = !DILocation(line: 57, column: 25, scope: !14)
-!112 = !DILocation(line: 58, column: 19, scope: !14)
-!113 = !DILocation(line: 58, column: 25, scope: !14)
-!114 = !DILocation(line: 59, column: 19, scope: !14)
-!115 = !DILocation(line: 59, column: 25, scope: !14)
-!116 = !DILocation(line: 61, column: 35, scope: !117)
-!117 = distinct !DILexicalBlock(scope: !14, file: !5, line: 61, column: 5)
-!118 = !DILocalVariable(name: "idx", scope: !117, file: !5, line: 61, type: !119)
-!119 = !DIBasicType(name: "long", size: 64, encoding: DW_ATE_signed)
-!120 = !DILocation(line: 61, column: 13, scope: !117)
-!121 = !DILocalVariable(name: "item", scope: !117, file: !5, line: 61, type: !66)
-!122 = !DILocation(line: 61, column: 23, scope: !117)
-!123 = !DILocation(line: 62, column: 9, scope: !117)
-!124 = !DILocation(line: 63, column: 5, scope: !117)
-!125 = !DILocation(line: 64, column: 19, scope: !14)
-!126 = !DILocation(line: 64, column: 25, scope: !14)
-!127 = !DILocation(line: 65, column: 19, scope: !14)
-!128 = !DILocation(line: 65, column: 25, scope: !14)
-!129 = !DILocation(line: 66, column: 19, scope: !14)
-!130 = !DILocation(line: 66, column: 25, scope: !14)
-!131 = !DILocation(line: 68, column: 5, scope: !14)
-!132 = !DILocation(line: 69, column: 1, scope: !14)
+!33 = !DIDerivedType(tag: DW_TAG_member, name: "size", scope: !27, file: !5, line: 29, baseType: !32, size: 64, offset: 192)
+!34 = !DIDerivedType(tag: DW_TAG_member, name: "growthPercent", scope: !27, file: !5, line: 30, baseType: !35, size: 32, offset: 256)
+!35 = !DIBasicType(name: "unsigned int", size: 32, encoding: DW_ATE_unsigned)
+!36 = !DIDerivedType(tag: DW_TAG_member, name: "arena", scope: !27, file: !5, line: 31, baseType: !37, size: 64, offset: 320)
+!37 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !38, size: 64)
+!38 = !DICompositeType(tag: DW_TAG_structure_type, name: "OffsetArena", scope: !5, file: !5, line: 382, size: 9600, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !39, identifier: "struct.OffsetArena")
+!39 = !{!40, !66}
+!40 = !DIDerivedType(tag: DW_TAG_member, name: "allocator", scope: !38, file: !5, line: 383, baseType: !41, size: 9536, align: 8)
+!41 = !DICompositeType(tag: DW_TAG_structure_type, name: "Allocator", scope: !5, file: !5, line: 64, size: 9536, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !42, identifier: "struct.Allocator")
+!42 = !{!43, !44, !45, !46, !47, !49, !51, !63, !65}
+!43 = !DIDerivedType(tag: DW_TAG_member, name: "size", scope: !41, file: !5, line: 65, baseType: !35, size: 32)
+!44 = !DIDerivedType(tag: DW_TAG_member, name: "maxAllocs", scope: !41, file: !5, line: 66, baseType: !35, size: 32, offset: 32)
+!45 = !DIDerivedType(tag: DW_TAG_member, name: "freeStorage", scope: !41, file: !5, line: 67, baseType: !35, size: 32, offset: 64)
+!46 = !DIDerivedType(tag: DW_TAG_member, name: "usedBinsTop", scope: !41, file: !5, line: 68, baseType: !35, size: 32, offset: 96)
+!47 = !DIDerivedType(tag: DW_TAG_member, name: "usedBins", scope: !41, file: !5, line: 69, baseType: !48, size: 32, offset: 128)
+!48 = !DICompositeType(tag: DW_TAG_array_type, baseType: !35, size: 32, elements: !21)
+!49 = !DIDerivedType(tag: DW_TAG_member, name: "binIndices", scope: !41, file: !5, line: 70, baseType: !50, size: 256, offset: 1152)
+!50 = !DICompositeType(tag: DW_TAG_array_type, baseType: !35, size: 256, elements: !21)
+!51 = !DIDerivedType(tag: DW_TAG_member, name: "nodes", scope: !41, file: !5, line: 71, baseType: !52, size: 64, offset: 9344)
+!52 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !53, size: 64)
+!53 = !DICompositeType(tag: DW_TAG_structure_type, name: "Node", scope: !5, file: !5, line: 46, size: 224, align: 4, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !54, identifier: "struct.Node")
+!54 = !{!55, !56, !57, !58, !59, !60, !61}
+!55 = !DIDerivedType(tag: DW_TAG_member, name: "dataOffset", scope: !53, file: !5, line: 47, baseType: !35, size: 32)
+!56 = !DIDerivedType(tag: DW_TAG_member, name: "dataSize", scope: !53, file: !5, line: 48, baseType: !35, size: 32, offset: 32)
+!57 = !DIDerivedType(tag: DW_TAG_member, name: "binListPrev", scope: !53, file: !5, line: 49, baseType: !35, size: 32, offset: 64)
+!58 = !DIDerivedType(tag: DW_TAG_member, name: "binListNext", scope: !53, file: !5, line: 50, baseType: !35, size: 32, offset: 96)
+!59 = !DIDerivedType(tag: DW_TAG_member, name: "neighborPrev", scope: !53, file: !5, line: 51, baseType: !35, size: 32, offset: 128)
+!60 = !DIDerivedType(tag: DW_TAG_member, name: "neighborNext", scope: !53, file: !5, line: 52, baseType: !35, size: 32, offset: 160)
+!61 = !DIDerivedType(tag: DW_TAG_member, name: "used", scope: !53, file: !5, line: 53, baseType: !62, size: 8, offset: 192)
+!62 = !DIBasicType(name: "bool", size: 8, encoding: DW_ATE_boolean)
+!63 = !DIDerivedType(tag: DW_TAG_member, name: "freeNodes", scope: !41, file: !5, line: 72, baseType: !64, size: 64, offset: 9408)
+!64 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !35, size: 64)
+!65 = !DIDerivedType(tag: DW_TAG_member, name: "freeOffset", scope: !41, file: !5, line: 73, baseType: !35, size: 32, offset: 9472)
+!66 = !DIDerivedType(tag: DW_TAG_member, name: "buffer", scope: !38, file: !5, line: 384, baseType: !67, size: 64, offset: 9536)
+!67 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !68, size: 64)
+!68 = !DIBasicType(name: "byte", size: 8, encoding: DW_ATE_unsigned)
+!69 = !DILocation(line: 6, column: 5, scope: !14)
+!70 = !DILocation(line: 6, column: 22, scope: !14)
+!71 = !DILocation(line: 7, column: 17, scope: !14)
+!72 = !DILocation(line: 8, column: 17, scope: !14)
+!73 = !DILocation(line: 9, column: 17, scope: !14)
+!74 = !DILocation(line: 10, column: 12, scope: !14)
+!75 = !DILocation(line: 10, column: 28, scope: !14)
+!76 = !{!"branch_weights", i32 2000, i32 1}
+!77 = !DILocation(line: 13, column: 14, scope: !14)
+!78 = !DILocalVariable(name: "it", scope: !14, file: !5, line: 13, type: !79)
+!79 = !DICompositeType(tag: DW_TAG_structure_type, name: "VectorIterator", scope: !5, file: !5, line: 444, size: 192, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !80, identifier: "struct.VectorIterator")
+!80 = !{!81, !83}
+!81 = !DIDerivedType(tag: DW_TAG_member, name: "vector", scope: !79, file: !5, line: 445, baseType: !82, size: 64, offset: 64)
+!82 = !DIDerivedType(tag: DW_TAG_reference_type, baseType: !27, size: 64)
+!83 = !DIDerivedType(tag: DW_TAG_member, name: "cursor", scope: !79, file: !5, line: 446, baseType: !32, size: 64, offset: 128)
+!84 = !DILocation(line: 13, column: 5, scope: !14)
+!85 = !DILocation(line: 14, column: 12, scope: !14)
+!86 = !DILocation(line: 15, column: 12, scope: !14)
+!87 = !DILocation(line: 15, column: 24, scope: !14)
+!88 = !DILocation(line: 16, column: 12, scope: !14)
+!89 = !DILocation(line: 16, column: 24, scope: !14)
+!90 = !DILocation(line: 17, column: 5, scope: !14)
+!91 = !DILocation(line: 18, column: 12, scope: !14)
+!92 = !DILocation(line: 18, column: 24, scope: !14)
+!93 = !DILocation(line: 19, column: 12, scope: !14)
+!94 = !DILocation(line: 20, column: 5, scope: !14)
+!95 = !DILocation(line: 21, column: 16, scope: !14)
+!96 = !DILocalVariable(name: "pair", scope: !14, file: !5, line: 21, type: !97)
+!97 = !DICompositeType(tag: DW_TAG_structure_type, name: "Pair", scope: !5, file: !5, line: 8, size: 128, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !98, identifier: "struct.Pair")
+!98 = !{!99, !100}
+!99 = !DIDerivedType(tag: DW_TAG_member, name: "first", scope: !97, file: !5, line: 9, baseType: !32, size: 64)
+!100 = !DIDerivedType(tag: DW_TAG_member, name: "second", scope: !97, file: !5, line: 10, baseType: !101, size: 64, offset: 64)
+!101 = !DIDerivedType(tag: DW_TAG_reference_type, baseType: !17, size: 64)
+!102 = !DILocation(line: 21, column: 5, scope: !14)
+!103 = !DILocation(line: 22, column: 12, scope: !14)
+!104 = !DILocation(line: 22, column: 31, scope: !14)
+!105 = !DILocation(line: 23, column: 12, scope: !14)
+!106 = !DILocation(line: 23, column: 32, scope: !14)
+!107 = !DILocation(line: 24, column: 5, scope: !14)
+!108 = !DILocation(line: 25, column: 13, scope: !14)
+!109 = !DILocation(line: 28, column: 17, scope: !14)
+!110 = !DILocation(line: 29, column: 17, scope: !14)
+!111 = !DILocation(line: 30, column: 12, scope: !14)
+!112 = !DILocation(line: 33, column: 5, scope: !14)
+!113 = !DILocation(line: 34, column: 12, scope: !14)
+!114 = !DILocation(line: 34, column: 24, scope: !14)
+!115 = !DILocation(line: 35, column: 12, scope: !14)
+!116 = !DILocation(line: 36, column: 5, scope: !14)
+!117 = !DILocation(line: 37, column: 12, scope: !14)
+!118 = !DILocation(line: 37, column: 24, scope: !14)
+!119 = !DILocation(line: 38, column: 5, scope: !14)
+!120 = !DILocation(line: 39, column: 12, scope: !14)
+!121 = !DILocation(line: 39, column: 24, scope: !14)
+!122 = !DILocation(line: 40, column: 5, scope: !14)
+!123 = !DILocation(line: 41, column: 12, scope: !14)
+!124 = !DILocation(line: 41, column: 24, scope: !14)
+!125 = !DILocation(line: 42, column: 5, scope: !14)
+!126 = !DILocation(line: 43, column: 13, scope: !14)
+!127 = !DILocation(line: 46, column: 24, scope: !128)
+!128 = distinct !DILexicalBlock(scope: !14, file: !5, line: 46, column: 5)
+!129 = !DILocalVariable(name: "item", scope: !128, file: !5, line: 46, type: !17)
+!130 = !DILocation(line: 46, column: 13, scope: !128)
+!131 = !DILocation(line: 47, column: 9, scope: !128)
+!132 = !DILocation(line: 48, column: 5, scope: !128)
+!133 = !DILocation(line: 49, column: 19, scope: !14)
+!134 = !DILocation(line: 49, column: 25, scope: !14)
+!135 = !DILocation(line: 50, column: 19, scope: !14)
+!136 = !DILocation(line: 50, column: 25, scope: !14)
+!137 = !DILocation(line: 51, column: 19, scope: !14)
+!138 = !DILocation(line: 51, column: 25, scope: !14)
+!139 = !DILocation(line: 54, column: 25, scope: !140)
+!140 = distinct !DILexicalBlock(scope: !14, file: !5, line: 54, column: 5)
+!141 = !DILocalVariable(name: "item", scope: !140, file: !5, line: 54, type: !101)
+!142 = !DILocation(line: 54, column: 13, scope: !140)
+!143 = !DILocation(line: 55, column: 9, scope: !140)
+!144 = !DILocation(line: 56, column: 5, scope: !140)
+!145 = !DILocation(line: 57, column: 19, scope: !14)
+!146 = !DILocation(line: 57, column: 25, scope: !14)
+!147 = !DILocation(line: 58, column: 19, scope: !14)
+!148 = !DILocation(line: 58, column: 25, scope: !14)
+!149 = !DILocation(line: 59, column: 19, scope: !14)
+!150 = !DILocation(line: 59, column: 25, scope: !14)
+!151 = !DILocation(line: 61, column: 35, scope: !152)
+!152 = distinct !DILexicalBlock(scope: !14, file: !5, line: 61, column: 5)
+!153 = !DILocalVariable(name: "idx", scope: !152, file: !5, line: 61, type: !154)
+!154 = !DIBasicType(name: "long", size: 64, encoding: DW_ATE_signed)
+!155 = !DILocation(line: 61, column: 13, scope: !152)
+!156 = !DILocalVariable(name: "item", scope: !152, file: !5, line: 61, type: !101)
+!157 = !DILocation(line: 61, column: 23, scope: !152)
+!158 = !DILocation(line: 62, column: 9, scope: !152)
+!159 = !DILocation(line: 63, column: 5, scope: !152)
+!160 = !DILocation(line: 64, column: 19, scope: !14)
+!161 = !DILocation(line: 64, column: 25, scope: !14)
+!162 = !DILocation(line: 65, column: 19, scope: !14)
+!163 = !DILocation(line: 65, column: 25, scope: !14)
+!164 = !DILocation(line: 66, column: 19, scope: !14)
+!165 = !DILocation(line: 66, column: 25, scope: !14)
+!166 = !DILocation(line: 68, column: 5, scope: !14)
+!167 = !DILocation(line: 69, column: 1, scope: !14)
@@ -22,9 +22,8 @@ define void @_ZN10TestStruct4dtorEv(ptr noundef nonnull align 8 dereferenceable(
 
 declare void @_ZN6String4dtorEv(ptr)
 
-define private %struct.TestStruct @_Z3fctRi(ptr %0) !dbg !46 {
+define private void @_Z3fctRi(ptr noalias nonnull sret(%struct.TestStruct) align 8 %result, ptr %0) !dbg !46 {
     #dbg_declare(ptr %result, !50, !DIExpression(), !51)
-  %result = alloca %struct.TestStruct, align 8
   %ref = alloca ptr, align 8
   %2 = alloca %struct.String, align 8
   %ts = alloca %struct.TestStruct, align 8
@@ -40,14 +39,17 @@ define private %struct.TestStruct @_Z3fctRi(ptr %0) !dbg !46 {
   %7 = getelementptr inbounds nuw %struct.TestStruct, ptr %ts, i32 0, i32 2, !dbg !55
     #dbg_declare(ptr %ts, !56, !DIExpression(), !57)
   store i32 %6, ptr %7, align 4, !dbg !55
-  %8 = load %struct.TestStruct, ptr %ts, align 8, !dbg !58
-  ret %struct.TestStruct %8, !dbg !59
+  call void @llvm.memcpy.p0.p0.i64(ptr %result, ptr %ts, i64 40, i1 false), !dbg !58
+  ret void, !dbg !59
 }
 
 declare void @_ZN6String4ctorEPKc(ptr, ptr)
 
+; Function Attrs: nocallback nofree nounwind willreturn memory(argmem: readwrite)
+declare void @llvm.memcpy.p0.p0.i64(ptr noalias nocapture writeonly, ptr noalias nocapture readonly, i64, i1 immarg) #1
+
 ; Function Attrs: noinline nounwind optnone uwtable
-define dso_local i32 @main() #1 !dbg !60 {
+define dso_local i32 @main() #2 !dbg !60 {
     #dbg_declare(ptr %result, !63, !DIExpression(), !64)
   %result = alloca i32, align 4
   %test = alloca i32, align 4
@@ -55,31 +57,31 @@ define dso_local i32 @main() #1 !dbg !60 {
   store i32 0, ptr %result, align 4, !dbg !64
     #dbg_declare(ptr %test, !65, !DIExpression(), !66)
   store i32 987654, ptr %test, align 4, !dbg !67
-  %1 = call %struct.TestStruct @_Z3fctRi(ptr %test), !dbg !68
     #dbg_declare(ptr %res, !69, !DIExpression(), !70)
-  store %struct.TestStruct %1, ptr %res, align 8, !dbg !68
+  call void @_Z3fctRi(ptr sret(%struct.TestStruct) %res, ptr %test), !dbg !68
   %lng_addr = getelementptr inbounds %struct.TestStruct, ptr %res, i64 0, i32 0, !dbg !71
-  %2 = load i64, ptr %lng_addr, align 8, !dbg !71
-  %3 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i64 %2), !dbg !71
-  %4 = getelementptr inbounds %struct.TestStruct, ptr %res, i64 0, i32 1, !dbg !72
-  %5 = call ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(24) %4), !dbg !72
-  %6 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, ptr %5), !dbg !72
+  %1 = load i64, ptr %lng_addr, align 8, !dbg !71
+  %2 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i64 %1), !dbg !71
+  %3 = getelementptr inbounds %struct.TestStruct, ptr %res, i64 0, i32 1, !dbg !72
+  %4 = call ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(24) %3), !dbg !72
+  %5 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, ptr %4), !dbg !72
   %i_addr = getelementptr inbounds %struct.TestStruct, ptr %res, i64 0, i32 2, !dbg !73
-  %7 = load i32, ptr %i_addr, align 4, !dbg !73
-  %8 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.2, i32 %7), !dbg !73
+  %6 = load i32, ptr %i_addr, align 4, !dbg !73
+  %7 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.2, i32 %6), !dbg !73
   call void @_ZN10TestStruct4dtorEv(ptr %res), !dbg !74
-  %9 = load i32, ptr %result, align 4, !dbg !74
-  ret i32 %9, !dbg !74
+  %8 = load i32, ptr %result, align 4, !dbg !74
+  ret i32 %8, !dbg !74
 }
 
 ; Function Attrs: nofree nounwind
-declare noundef i32 @printf(ptr nocapture noundef readonly, ...) #2
+declare noundef i32 @printf(ptr nocapture noundef readonly, ...) #3
 
 declare ptr @_ZN6String6getRawEv(ptr)
 
 attributes #0 = { norecurse }
-attributes #1 = { noinline nounwind optnone uwtable }
-attributes #2 = { nofree nounwind }
+attributes #1 = { nocallback nofree nounwind willreturn memory(argmem: readwrite) }
+attributes #2 = { noinline nounwind optnone uwtable }
+attributes #3 = { nofree nounwind }
 
 !llvm.module.flags = !{!16, !17, !18, !19, !20, !21}
 !llvm.ident = !{!22}
@@ -40,20 +40,19 @@ foreach.body.L5:                                  ; preds = %foreach.head.L5
   br i1 %13, label %if.then.L7, label %if.exit.L7
 
 if.then.L7:                                       ; preds = %foreach.body.L5
-  %14 = call %struct.NumberIterator.0 @_Z5rangeIlE14NumberIteratorIlEll(i64 1, i64 2)
-  store %struct.NumberIterator.0 %14, ptr %1, align 8
+  call void @_Z5rangeIlE14NumberIteratorIlEll(ptr sret(%struct.NumberIterator.0) %1, i64 1, i64 2)
   br label %foreach.head.L8
 
 foreach.head.L8:                                  ; preds = %foreach.tail.L8, %if.then.L7
-  %15 = call i1 @_ZN14NumberIteratorIlE7isValidEv(ptr %1)
-  br i1 %15, label %foreach.body.L8, label %foreach.exit.L8
+  %14 = call i1 @_ZN14NumberIteratorIlE7isValidEv(ptr %1)
+  br i1 %14, label %foreach.body.L8, label %foreach.exit.L8
 
 foreach.body.L8:                                  ; preds = %foreach.head.L8
-  %16 = call ptr @_ZN14NumberIteratorIlE3getEv(ptr %1)
-  store ptr %16, ptr %2, align 8
-  %17 = load ptr, ptr %2, align 8
-  %18 = load i64, ptr %17, align 8
-  %19 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, i64 %18)
+  %15 = call ptr @_ZN14NumberIteratorIlE3getEv(ptr %1)
+  store ptr %15, ptr %2, align 8
+  %16 = load ptr, ptr %2, align 8
+  %17 = load i64, ptr %16, align 8
+  %18 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, i64 %17)
   br label %foreach.exit.L5
 
 foreach.tail.L8:                                  ; No predecessors!
@@ -71,9 +70,9 @@ foreach.tail.L5:                                  ; preds = %if.exit.L7
   br label %foreach.head.L5
 
 foreach.exit.L5:                                  ; preds = %foreach.body.L8, %foreach.head.L5
-  %20 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.2)
-  %21 = load i32, ptr %result, align 4
-  ret i32 %21
+  %19 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.2)
+  %20 = load i32, ptr %result, align 4
+  ret i32 %20
 }
 
 declare %struct.NumberIterator @_Z5rangeIsE14NumberIteratorIsEss(i16, i16)
@@ -85,7 +84,7 @@ declare ptr @_ZN14NumberIteratorIsE3getEv(ptr)
 ; Function Attrs: nofree nounwind
 declare noundef i32 @printf(ptr nocapture noundef readonly, ...) #1
 
-declare %struct.NumberIterator.0 @_Z5rangeIlE14NumberIteratorIlEll(i64, i64)
+declare void @_Z5rangeIlE14NumberIteratorIlEll(ptr, i64, i64)
 
 declare i1 @_ZN14NumberIteratorIlE7isValidEv(ptr)
 
@@ -26,15 +26,9 @@ define dso_local i32 @main() local_unnamed_addr #0 {
   %.fca.3.gep9 = getelementptr inbounds nuw i8, ptr %shortIterator, i64 12
   store i16 %.fca.3.extract8, ptr %.fca.3.gep9, align 4
   %3 = call i1 @_ZN14NumberIteratorIsE7isValidEv(ptr nonnull %shortIterator) #2
-  br i1 %3, label %foreach.body.L5.lr.ph, label %foreach.exit.L5
+  br i1 %3, label %foreach.body.L5, label %foreach.exit.L5
 
-foreach.body.L5.lr.ph:                            ; preds = %0
-  %.fca.1.gep = getelementptr inbounds nuw i8, ptr %1, i64 8
-  %.fca.2.gep = getelementptr inbounds nuw i8, ptr %1, i64 16
-  %.fca.3.gep = getelementptr inbounds nuw i8, ptr %1, i64 24
-  br label %foreach.body.L5
-
-foreach.body.L5:                                  ; preds = %foreach.body.L5.lr.ph, %foreach.tail.L5
+foreach.body.L5:                                  ; preds = %0, %foreach.tail.L5
   %4 = call ptr @_ZN14NumberIteratorIsE3getEv(ptr nonnull %shortIterator) #2
   %5 = load i16, ptr %4, align 2
   %6 = sext i16 %5 to i32
@@ -44,31 +38,23 @@ foreach.body.L5:                                  ; preds = %foreach.body.L5.lr.
   br i1 %.not, label %foreach.tail.L5, label %if.then.L7
 
 if.then.L7:                                       ; preds = %foreach.body.L5
-  %9 = call %struct.NumberIterator.0 @_Z5rangeIlE14NumberIteratorIlEll(i64 1, i64 2) #2
-  %.fca.0.0.extract = extractvalue %struct.NumberIterator.0 %9, 0, 0
-  store ptr %.fca.0.0.extract, ptr %1, align 8
-  %.fca.1.extract = extractvalue %struct.NumberIterator.0 %9, 1
-  store i64 %.fca.1.extract, ptr %.fca.1.gep, align 8
-  %.fca.2.extract = extractvalue %struct.NumberIterator.0 %9, 2
-  store i64 %.fca.2.extract, ptr %.fca.2.gep, align 8
-  %.fca.3.extract = extractvalue %struct.NumberIterator.0 %9, 3
-  store i64 %.fca.3.extract, ptr %.fca.3.gep, align 8
-  %10 = call i1 @_ZN14NumberIteratorIlE7isValidEv(ptr nonnull %1) #2
-  br i1 %10, label %foreach.body.L8, label %foreach.tail.L5
+  call void @_Z5rangeIlE14NumberIteratorIlEll(ptr nonnull sret(%struct.NumberIterator.0) %1, i64 1, i64 2) #2
+  %9 = call i1 @_ZN14NumberIteratorIlE7isValidEv(ptr nonnull %1) #2
+  br i1 %9, label %foreach.body.L8, label %foreach.tail.L5
 
 foreach.body.L8:                                  ; preds = %if.then.L7
-  %11 = call ptr @_ZN14NumberIteratorIlE3getEv(ptr nonnull %1) #2
-  %12 = load i64, ptr %11, align 8
-  %13 = call i32 (ptr, ...) @printf(ptr noundef nonnull dereferenceable(1) @printf.str.1, i64 %12)
+  %10 = call ptr @_ZN14NumberIteratorIlE3getEv(ptr nonnull %1) #2
+  %11 = load i64, ptr %10, align 8
+  %12 = call i32 (ptr, ...) @printf(ptr noundef nonnull dereferenceable(1) @printf.str.1, i64 %11)
   br label %foreach.tail.L5
 
 foreach.tail.L5:                                  ; preds = %foreach.body.L5, %if.then.L7, %foreach.body.L8
   call void @_ZN14NumberIteratorIsE4nextEv(ptr nonnull %shortIterator) #2
-  %14 = call i1 @_ZN14NumberIteratorIsE7isValidEv(ptr nonnull %shortIterator) #2
-  br i1 %14, label %foreach.body.L5, label %foreach.exit.L5
+  %13 = call i1 @_ZN14NumberIteratorIsE7isValidEv(ptr nonnull %shortIterator) #2
+  br i1 %13, label %foreach.body.L5, label %foreach.exit.L5
 
 foreach.exit.L5:                                  ; preds = %foreach.tail.L5, %0
-  %15 = call i32 (ptr, ...) @printf(ptr noundef nonnull dereferenceable(1) @printf.str.2)
+  %14 = call i32 (ptr, ...) @printf(ptr noundef nonnull dereferenceable(1) @printf.str.2)
   ret i32 0
 }
 
@@ -81,7 +67,7 @@ declare ptr @_ZN14NumberIteratorIsE3getEv(ptr) local_unnamed_addr
 ; Function Attrs: nofree nounwind
 declare noundef i32 @printf(ptr nocapture noundef readonly, ...) local_unnamed_addr #1
 
-declare %struct.NumberIterator.0 @_Z5rangeIlE14NumberIteratorIlEll(i64, i64) local_unnamed_addr
+declare void @_Z5rangeIlE14NumberIteratorIlEll(ptr, i64, i64) local_unnamed_addr
 
 declare i1 @_ZN14NumberIteratorIlE7isValidEv(ptr) local_unnamed_addr
 
@@ -19,25 +19,24 @@ define dso_local i32 @main() #0 {
   store i32 0, ptr %result, align 4
   store [7 x i32] [i32 1, i32 5, i32 4, i32 0, i32 12, i32 12345, i32 9], ptr %intArray, align 4
   %2 = getelementptr inbounds [7 x i32], ptr %intArray, i64 0, i32 0
-  %3 = call %struct.ArrayIterator @_Z7iterateIiE13ArrayIteratorIiEPim(ptr %2, i64 7)
-  store %struct.ArrayIterator %3, ptr %1, align 8
+  call void @_Z7iterateIiE13ArrayIteratorIiEPim(ptr sret(%struct.ArrayIterator) %1, ptr %2, i64 7)
   store i64 0, ptr %index, align 8
   br label %foreach.head.L5
 
 foreach.head.L5:                                  ; preds = %foreach.tail.L5, %0
-  %4 = call i1 @_ZN13ArrayIteratorIiE7isValidEv(ptr %1)
-  br i1 %4, label %foreach.body.L5, label %foreach.exit.L5
+  %3 = call i1 @_ZN13ArrayIteratorIiE7isValidEv(ptr %1)
+  br i1 %3, label %foreach.body.L5, label %foreach.exit.L5
 
 foreach.body.L5:                                  ; preds = %foreach.head.L5
   %pair = call %struct.Pair @_ZN13ArrayIteratorIiE6getIdxEv(ptr %1)
   store %struct.Pair %pair, ptr %pair_addr, align 8
-  %5 = load i64, ptr %pair_addr, align 8
-  store i64 %5, ptr %index, align 8
+  %4 = load i64, ptr %pair_addr, align 8
+  store i64 %4, ptr %index, align 8
   %item_addr = getelementptr inbounds nuw %struct.Pair, ptr %pair_addr, i32 0, i32 1
-  %6 = load ptr, ptr %item_addr, align 8
-  %7 = load i64, ptr %index, align 8
-  %8 = load i32, ptr %6, align 4
-  %9 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i64 %7, i32 %8)
+  %5 = load ptr, ptr %item_addr, align 8
+  %6 = load i64, ptr %index, align 8
+  %7 = load i32, ptr %5, align 4
+  %8 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i64 %6, i32 %7)
   br label %foreach.tail.L5
 
 foreach.tail.L5:                                  ; preds = %foreach.body.L5
@@ -45,11 +44,11 @@ foreach.tail.L5:                                  ; preds = %foreach.body.L5
   br label %foreach.head.L5
 
 foreach.exit.L5:                                  ; preds = %foreach.head.L5
-  %10 = load i32, ptr %result, align 4
-  ret i32 %10
+  %9 = load i32, ptr %result, align 4
+  ret i32 %9
 }
 
-declare %struct.ArrayIterator @_Z7iterateIiE13ArrayIteratorIiEPim(ptr, i64)
+declare void @_Z7iterateIiE13ArrayIteratorIiEPim(ptr, ptr, i64)
 
 declare i1 @_ZN13ArrayIteratorIiE7isValidEv(ptr)
 
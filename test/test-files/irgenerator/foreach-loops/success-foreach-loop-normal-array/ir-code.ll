@@ -18,20 +18,19 @@ define dso_local i32 @main() #0 {
   %2 = alloca %struct.ArrayIterator, align 8
   %item1 = alloca i32, align 4
   store i32 0, ptr %result, align 4
-  %3 = call %struct.ArrayIterator @_Z7iterateIiE13ArrayIteratorIiEPim(ptr @anon.array.0, i64 7)
-  store %struct.ArrayIterator %3, ptr %1, align 8
+  call void @_Z7iterateIiE13ArrayIteratorIiEPim(ptr sret(%struct.ArrayIterator) %1, ptr @anon.array.0, i64 7)
   br label %foreach.head.L4
 
 foreach.head.L4:                                  ; preds = %foreach.tail.L4, %0
-  %4 = call i1 @_ZN13ArrayIteratorIiE7isValidEv(ptr %1)
-  br i1 %4, label %foreach.body.L4, label %foreach.exit.L4
+  %3 = call i1 @_ZN13ArrayIteratorIiE7isValidEv(ptr %1)
+  br i1 %3, label %foreach.body.L4, label %foreach.exit.L4
 
 foreach.body.L4:                                  ; preds = %foreach.head.L4
-  %5 = call ptr @_ZN13ArrayIteratorIiE3getEv(ptr %1)
-  %6 = load i32, ptr %5, align 4
-  store i32 %6, ptr %item, align 4
-  %7 = load i32, ptr %item, align 4
-  %8 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 %7)
+  %4 = call ptr @_ZN13ArrayIteratorIiE3getEv(ptr %1)
+  %5 = load i32, ptr %4, align 4
+  store i32 %5, ptr %item, align 4
+  %6 = load i32, ptr %item, align 4
+  %7 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 %6)
   br label %foreach.tail.L4
 
 foreach.tail.L4:                                  ; preds = %foreach.body.L4
@@ -40,20 +39,19 @@ foreach.tail.L4:                                  ; preds = %foreach.body.L4
 
 foreach.exit.L4:                                  ; preds = %foreach.head.L4
   store [7 x i32] [i32 1, i32 5, i32 4, i32 0, i32 12, i32 12345, i32 9], ptr %array, align 4
-  %9 = call %struct.ArrayIterator @_Z7iterateIiE13ArrayIteratorIiEPim(ptr %array, i64 7)
-  store %struct.ArrayIterator %9, ptr %2, align 8
+  call void @_Z7iterateIiE13ArrayIteratorIiEPim(ptr sret(%struct.ArrayIterator) %2, ptr %array, i64 7)
   br label %foreach.head.L8
 
 foreach.head.L8:                                  ; preds = %foreach.tail.L8, %foreach.exit.L4
-  %10 = call i1 @_ZN13ArrayIteratorIiE7isValidEv(ptr %2)
-  br i1 %10, label %foreach.body.L8, label %foreach.exit.L8
+  %8 = call i1 @_ZN13ArrayIteratorIiE7isValidEv(ptr %2)
+  br i1 %8, label %foreach.body.L8, label %foreach.exit.L8
 
 foreach.body.L8:                                  ; preds = %foreach.head.L8
-  %11 = call ptr @_ZN13ArrayIteratorIiE3getEv(ptr %2)
-  %12 = load i32, ptr %11, align 4
-  store i32 %12, ptr %item1, align 4
-  %13 = load i32, ptr %item1, align 4
-  %14 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, i32 %13)
+  %9 = call ptr @_ZN13ArrayIteratorIiE3getEv(ptr %2)
+  %10 = load i32, ptr %9, align 4
+  store i32 %10, ptr %item1, align 4
+  %11 = load i32, ptr %item1, align 4
+  %12 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, i32 %11)
   br label %foreach.tail.L8
 
 foreach.tail.L8:                                  ; preds = %foreach.body.L8
@@ -61,11 +59,11 @@ foreach.tail.L8:                                  ; preds = %foreach.body.L8
   br label %foreach.head.L8
 
 foreach.exit.L8:                                  ; preds = %foreach.head.L8
-  %15 = load i32, ptr %result, align 4
-  ret i32 %15
+  %13 = load i32, ptr %result, align 4
+  ret i32 %13
 }
 
-declare %struct.ArrayIterator @_Z7iterateIiE13ArrayIteratorIiEPim(ptr, i64)
+declare void @_Z7iterateIiE13ArrayIteratorIiEPim(ptr, ptr, i64)
 
 declare i1 @_ZN13ArrayIteratorIiE7isValidEv(ptr)
 
@@ -1,7 +1,7 @@
 ; ModuleID = 'source.spice'
 source_filename = "source.spice"
 
-%struct.Vector = type { %interface.IIterable, ptr, i64, i64 }
+%struct.Vector = type { %interface.IIterable, ptr, i64, i64, i32, ptr }
 %interface.IIterable = type { ptr }
 %struct.VectorIterator = type { %interface.IIterator, ptr, i64 }
 %interface.IIterator = type { ptr }
@@ -24,33 +24,32 @@ define dso_local i32 @main() #0 {
   store i32 0, ptr %result, align 4
   call void @_ZN6VectorIiE4ctorEv(ptr %intVector)
   store i32 1, ptr %1, align 4
-  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(32) %intVector, ptr %1)
+  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(48) %intVector, ptr %1)
   store i32 5, ptr %2, align 4
-  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(32) %intVector, ptr %2)
+  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(48) %intVector, ptr %2)
   store i32 4, ptr %3, align 4
-  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(32) %intVector, ptr %3)
+  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(48) %intVector, ptr %3)
   store i32 0, ptr %4, align 4
-  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(32) %intVector, ptr %4)
+  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(48) %intVector, ptr %4)
   store i32 12, ptr %5, align 4
-  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(32) %intVector, ptr %5)
+  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(48) %intVector, ptr %5)
   store i32 12345, ptr %6, align 4
-  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(32) %intVector, ptr %6)
+  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(48) %intVector, ptr %6)
   store i32 9, ptr %7, align 4
-  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(32) %intVector, ptr %7)
-  %9 = call %struct.VectorIterator @_ZN6VectorIiE11getIteratorEv(ptr %intVector)
-  store %struct.VectorIterator %9, ptr %8, align 8
+  call void @_ZN6VectorIiE8pushBackERKi(ptr noundef nonnull align 8 dereferenceable(48) %intVector, ptr %7)
+  call void @_ZN6VectorIiE11getIteratorEv(ptr %intVector, ptr sret(%struct.VectorIterator) %8)
   br label %foreach.head.L12
 
 foreach.head.L12:                                 ; preds = %foreach.tail.L12, %0
-  %10 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr %8)
-  br i1 %10, label %foreach.body.L12, label %foreach.exit.L12
+  %9 = call i1 @_ZN14VectorIteratorIiE7isValidEv(ptr %8)
+  br i1 %9, label %foreach.body.L12, label %foreach.exit.L12
 
 foreach.body.L12:                                 ; preds = %foreach.head.L12
-  %11 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr %8)
-  %12 = load i32, ptr %11, align 4
-  store i32 %12, ptr %item, align 4
-  %13 = load i32, ptr %item, align 4
-  %14 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 %13)
+  %10 = call ptr @_ZN14VectorIteratorIiE3getEv(ptr %8)
+  %11 = load i32, ptr %10, align 4
+  store i32 %11, ptr %item, align 4
+  %12 = load i32, ptr %item, align 4
+  %13 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 %12)
   br label %foreach.tail.L12
 
 foreach.tail.L12:                                 ; preds = %foreach.body.L12
@@ -59,15 +58,15 @@ foreach.tail.L12:                                 ; preds = %foreach.body.L12
 
 foreach.exit.L12:                                 ; preds = %foreach.head.L12
   call void @_ZN6VectorIiE4dtorEv(ptr %intVector)
-  %15 = load i32, ptr %result, align 4
-  ret i32 %15
+  %14 = load i32, ptr %result, align 4
+  ret i32 %14
 }
 
 declare void @_ZN6VectorIiE4ctorEv(ptr)
 
 declare void @_ZN6VectorIiE8pushBackERKi(ptr, ptr)
 
-declare %struct.VectorIterator @_ZN6VectorIiE11getIteratorEv(ptr)
+declare void @_ZN6VectorIiE11getIteratorEv(ptr, ptr)
 
 declare i1 @_ZN14VectorIteratorIiE7isValidEv(ptr)
 
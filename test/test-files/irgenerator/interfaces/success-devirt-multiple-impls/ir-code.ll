@@ -0,0 +1,154 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+%struct.Car = type { %interface.Driveable, i1 }
+%interface.Driveable = type { ptr }
+%struct.Bike = type { %interface.Driveable, i1 }
+
+$_ZTS9Driveable = comdat any
+
+$_ZTI9Driveable = comdat any
+
+$_ZTV9Driveable = comdat any
+
+$_ZTS3Car = comdat any
+
+$_ZTI3Car = comdat any
+
+$_ZTV3Car = comdat any
+
+$_ZTS4Bike = comdat any
+
+$_ZTI4Bike = comdat any
+
+$_ZTV4Bike = comdat any
+
+@_ZTS9Driveable = dso_local constant [11 x i8] c"9Driveable\00", comdat, align 1
+@_ZTV8TypeInfo = external global ptr
+@_ZTI9Driveable = dso_local constant { ptr, ptr } { ptr getelementptr inbounds (ptr, ptr @_ZTV8TypeInfo, i64 2), ptr @_ZTS9Driveable }, comdat, align 8
+@_ZTV9Driveable = dso_local unnamed_addr constant { [4 x ptr] } { [4 x ptr] [ptr null, ptr @_ZTI9Driveable, ptr null, ptr null] }, comdat, align 8
+@_ZTS3Car = dso_local constant [5 x i8] c"3Car\00", comdat, align 1
+@_ZTI3Car = dso_local constant { ptr, ptr, ptr } { ptr getelementptr inbounds (ptr, ptr @_ZTV8TypeInfo, i64 2), ptr @_ZTS3Car, ptr @_ZTI9Driveable }, comdat, align 8
+@_ZTV3Car = dso_local unnamed_addr constant { [4 x ptr] } { [4 x ptr] [ptr null, ptr @_ZTI3Car, ptr @_ZN3Car5driveEi, ptr @_ZN3Car9isDrivingEv] }, comdat, align 8
+@_ZTS4Bike = dso_local constant [6 x i8] c"4Bike\00", comdat, align 1
+@_ZTI4Bike = dso_local constant { ptr, ptr, ptr } { ptr getelementptr inbounds (ptr, ptr @_ZTV8TypeInfo, i64 2), ptr @_ZTS4Bike, ptr @_ZTI9Driveable }, comdat, align 8
+@_ZTV4Bike = dso_local unnamed_addr constant { [4 x ptr] } { [4 x ptr] [ptr null, ptr @_ZTI4Bike, ptr @_ZN4Bike5driveEi, ptr @_ZN4Bike9isDrivingEv] }, comdat, align 8
+@printf.str.0 = private unnamed_addr constant [15 x i8] c"Is driving: %d\00", align 1
+
+define private void @_ZN3Car4ctorEv(ptr noundef nonnull align 8 dereferenceable(16) %0) {
+  %this = alloca ptr, align 8
+  store ptr %0, ptr %this, align 8, !tbaa !5
+  %2 = load ptr, ptr %this, align 8, !tbaa !5
+  store ptr getelementptr inbounds ({ [4 x ptr] }, ptr @_ZTV3Car, i64 0, i32 0, i32 2), ptr %2, align 8, !tbaa !9
+  %3 = getelementptr inbounds %struct.Car, ptr %2, i64 0, i32 1
+  store i1 false, ptr %3, align 1, !tbaa !9
+  %4 = load ptr, ptr %this, align 8, !tbaa !5
+  %driving_addr = getelementptr inbounds %struct.Car, ptr %4, i64 0, i32 1
+  store i1 false, ptr %driving_addr, align 1, !tbaa !9
+  ret void
+}
+
+define private void @_ZN3Car5driveEi(ptr noundef nonnull align 8 dereferenceable(16) %0, i32 %1) {
+  %this = alloca ptr, align 8
+  %param = alloca i32, align 4
+  store ptr %0, ptr %this, align 8, !tbaa !5
+  store i32 %1, ptr %param, align 4, !tbaa !10
+  %3 = load ptr, ptr %this, align 8, !tbaa !5
+  %driving_addr = getelementptr inbounds %struct.Car, ptr %3, i64 0, i32 1
+  store i1 true, ptr %driving_addr, align 1, !tbaa !9
+  ret void
+}
+
+define private i1 @_ZN3Car9isDrivingEv(ptr noundef nonnull align 8 dereferenceable(16) %0) {
+  %result = alloca i1, align 1
+  %this = alloca ptr, align 8
+  store ptr %0, ptr %this, align 8, !tbaa !5
+  %2 = load ptr, ptr %this, align 8, !tbaa !5
+  %driving_addr = getelementptr inbounds %struct.Car, ptr %2, i64 0, i32 1
+  %3 = load i1, ptr %driving_addr, align 1, !tbaa !9
+  ret i1 %3
+}
+
+define private void @_ZN4Bike4ctorEv(ptr noundef nonnull align 8 dereferenceable(16) %0) {
+  %this = alloca ptr, align 8
+  store ptr %0, ptr %this, align 8, !tbaa !5
+  %2 = load ptr, ptr %this, align 8, !tbaa !5
+  store ptr getelementptr inbounds ({ [4 x ptr] }, ptr @_ZTV4Bike, i64 0, i32 0, i32 2), ptr %2, align 8, !tbaa !9
+  %3 = getelementptr inbounds %struct.Bike, ptr %2, i64 0, i32 1
+  store i1 false, ptr %3, align 1, !tbaa !9
+  %4 = load ptr, ptr %this, align 8, !tbaa !5
+  %driving_addr = getelementptr inbounds %struct.Bike, ptr %4, i64 0, i32 1
+  store i1 false, ptr %driving_addr, align 1, !tbaa !9
+  ret void
+}
+
+define private void @_ZN4Bike5driveEi(ptr noundef nonnull align 8 dereferenceable(16) %0, i32 %1) {
+  %this = alloca ptr, align 8
+  %param = alloca i32, align 4
+  store ptr %0, ptr %this, align 8, !tbaa !5
+  store i32 %1, ptr %param, align 4, !tbaa !10
+  %3 = load ptr, ptr %this, align 8, !tbaa !5
+  %driving_addr = getelementptr inbounds %struct.Bike, ptr %3, i64 0, i32 1
+  store i1 true, ptr %driving_addr, align 1, !tbaa !9
+  ret void
+}
+
+define private i1 @_ZN4Bike9isDrivingEv(ptr noundef nonnull align 8 dereferenceable(16) %0) {
+  %result = alloca i1, align 1
+  %this = alloca ptr, align 8
+  store ptr %0, ptr %this, align 8, !tbaa !5
+  %2 = load ptr, ptr %this, align 8, !tbaa !5
+  %driving_addr = getelementptr inbounds %struct.Bike, ptr %2, i64 0, i32 1
+  %3 = load i1, ptr %driving_addr, align 1, !tbaa !9
+  ret i1 %3
+}
+
+; Function Attrs: noinline nounwind uwtable
+define dso_local i32 @main() #0 {
+  %result = alloca i32, align 4
+  %car = alloca %struct.Car, align 8
+  %bike = alloca %struct.Bike, align 8
+  %driveable = alloca ptr, align 8
+  %otherDriveable = alloca ptr, align 8
+  store i32 0, ptr %result, align 4, !tbaa !10
+  call void @_ZN3Car4ctorEv(ptr noundef nonnull align 8 dereferenceable(16) %car)
+  call void @_ZN4Bike4ctorEv(ptr noundef nonnull align 8 dereferenceable(16) %bike)
+  store ptr %car, ptr %driveable, align 8, !tbaa !5
+  %1 = load ptr, ptr %driveable, align 8, !tbaa !5
+  %vtable.addr = load ptr, ptr %1, align 8, !tbaa !9
+  %vfct.addr = getelementptr inbounds ptr, ptr %vtable.addr, i64 0
+  %fct = load ptr, ptr %vfct.addr, align 8, !tbaa !9
+  call void %fct(ptr noundef nonnull align 8 dereferenceable(8) %1, i32 12)
+  store ptr %bike, ptr %otherDriveable, align 8, !tbaa !5
+  %2 = load ptr, ptr %otherDriveable, align 8, !tbaa !5
+  %vtable.addr1 = load ptr, ptr %2, align 8, !tbaa !9
+  %vfct.addr2 = getelementptr inbounds ptr, ptr %vtable.addr1, i64 1
+  %fct3 = load ptr, ptr %vfct.addr2, align 8, !tbaa !9
+  %3 = call i1 %fct3(ptr noundef nonnull align 8 dereferenceable(8) %2)
+  %4 = zext i1 %3 to i32
+  %5 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 %4)
+  %6 = load i32, ptr %result, align 4, !tbaa !10
+  ret i32 %6
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr nocapture noundef readonly, ...) #1
+
+attributes #0 = { noinline nounwind uwtable }
+attributes #1 = { nofree nounwind }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
+!5 = !{!6, !6, i64 0}
+!6 = !{!"any pointer", !7, i64 0}
+!7 = !{!"omnipotent char", !8, i64 0}
+!8 = !{!"Spice TBAA"}
+!9 = !{!7, !7, i64 0}
+!10 = !{!11, !11, i64 0}
+!11 = !{!"int", !7, i64 0}
@@ -24,7 +24,6 @@ define dso_local i32 @main() #0 {
   %fat.ptr3 = alloca { ptr, ptr }, align 8
   %callbackWithArgs2 = alloca { ptr, ptr }, align 8
   %2 = alloca %struct.String, align 8
-  %arg.copy = alloca %struct.String, align 8
   store i32 0, ptr %result, align 4
   store ptr @_Z14lambda.L2C39.0v, ptr %fat.ptr, align 8
   %3 = getelementptr inbounds nuw { ptr, ptr }, ptr %fat.ptr, i32 0, i32 1
@@ -50,8 +49,7 @@ define dso_local i32 @main() #0 {
   %13 = load { ptr, ptr }, ptr %fat.ptr3, align 8
   store { ptr, ptr } %13, ptr %callbackWithArgs2, align 8
   call void @_ZN6String4ctorEPKc(ptr noundef nonnull align 8 dereferenceable(24) %2, ptr @anon.string.3)
-  call void @_ZN6String4ctorERK6String(ptr %arg.copy, ptr %2)
-  %14 = load %struct.String, ptr %arg.copy, align 8
+  %14 = load %struct.String, ptr %2, align 8
   %fct4 = load ptr, ptr %callbackWithArgs2, align 8
   %15 = call i16 %fct4(%struct.String %14, i16 321)
   %16 = xor i16 %15, 956
@@ -60,7 +58,6 @@ define dso_local i32 @main() #0 {
   %19 = select i1 %18, i32 9, i32 12
   %20 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.4, i32 %19)
   call void @_ZN6String4dtorEv(ptr %2)
-  call void @_ZN6String4dtorEv(ptr %arg.copy)
   call void @_ZN6String4dtorEv(ptr %1)
   %21 = load i32, ptr %result, align 4
   ret i32 %21
@@ -81,9 +78,13 @@ define private i1 @_Z14lambda.L7C50.0R6Stringd(ptr %0, double %1) {
   store ptr %0, ptr %str, align 8
   store double %1, ptr %d, align 8
   %3 = load ptr, ptr %str, align 8
-  %4 = load ptr, ptr %3, align 8
+  %4 = getelementptr inbounds nuw %struct.String, ptr %3, i32 0, i32 2
+  %str.length.field = load i64, ptr %4, align 8
+  %str.long = icmp slt i64 %str.length.field, 0
+  %str.heap = load ptr, ptr %3, align 8
+  %str.chars = select i1 %str.long, ptr %str.heap, ptr %3
   %5 = load double, ptr %d, align 8
-  %6 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, ptr %4, double %5)
+  %6 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, ptr %str.chars, double %5)
   %7 = load ptr, ptr %str, align 8
   %8 = call ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(8) %7)
   %9 = call i1 @_Z10isRawEqualPKcPKc(ptr %8, ptr @anon.string.1)
@@ -111,17 +112,19 @@ define private i16 @_Z15lambda.L13C49.06Strings(%struct.String %0, i16 %1) {
   %b = alloca i16, align 2
   store %struct.String %0, ptr %str, align 8
   store i16 %1, ptr %b, align 2
-  %3 = load ptr, ptr %str, align 8
+  %3 = getelementptr inbounds nuw %struct.String, ptr %str, i32 0, i32 2
+  %str.length.field = load i64, ptr %3, align 8
+  %str.long = icmp slt i64 %str.length.field, 0
+  %str.heap = load ptr, ptr %str, align 8
+  %str.chars = select i1 %str.long, ptr %str.heap, ptr %str
   %4 = load i16, ptr %b, align 2
   %5 = sext i16 %4 to i32
-  %6 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.3, ptr %3, i32 %5)
+  %6 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.3, ptr %str.chars, i32 %5)
   %7 = load i16, ptr %b, align 2
   %8 = xor i16 %7, -1
   ret i16 %8
 }
 
-declare void @_ZN6String4ctorERK6String(ptr, ptr)
-
 declare void @_ZN6String4dtorEv(ptr)
 
 attributes #0 = { noinline nounwind optnone uwtable }
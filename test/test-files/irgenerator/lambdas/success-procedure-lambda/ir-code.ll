@@ -20,7 +20,6 @@ define dso_local i32 @main() #0 {
   %fat.ptr3 = alloca { ptr, ptr }, align 8
   %callbackWithArgs2 = alloca { ptr, ptr }, align 8
   %2 = alloca %struct.String, align 8
-  %arg.copy = alloca %struct.String, align 8
   store i32 0, ptr %result, align 4
   store ptr @_Z14lambda.L2C31.0v, ptr %fat.ptr, align 8
   %3 = getelementptr inbounds nuw { ptr, ptr }, ptr %fat.ptr, i32 0, i32 1
@@ -43,12 +42,10 @@ define dso_local i32 @main() #0 {
   %8 = load { ptr, ptr }, ptr %fat.ptr3, align 8
   store { ptr, ptr } %8, ptr %callbackWithArgs2, align 8
   call void @_ZN6String4ctorEPKc(ptr noundef nonnull align 8 dereferenceable(24) %2, ptr @anon.string.1)
-  call void @_ZN6String4ctorERK6String(ptr %arg.copy, ptr %2)
-  %9 = load %struct.String, ptr %arg.copy, align 8
+  %9 = load %struct.String, ptr %2, align 8
   %fct4 = load ptr, ptr %callbackWithArgs2, align 8
   call void %fct4(%struct.String %9, i1 false)
   call void @_ZN6String4dtorEv(ptr %2)
-  call void @_ZN6String4dtorEv(ptr %arg.copy)
   call void @_ZN6String4dtorEv(ptr %1)
   %10 = load i32, ptr %result, align 4
   ret i32 %10
@@ -68,9 +65,13 @@ define private void @_Z14lambda.L7C44.0R6Stringd(ptr %0, double %1) {
   store ptr %0, ptr %str, align 8
   store double %1, ptr %d, align 8
   %3 = load ptr, ptr %str, align 8
-  %4 = load ptr, ptr %3, align 8
+  %4 = getelementptr inbounds nuw %struct.String, ptr %3, i32 0, i32 2
+  %str.length.field = load i64, ptr %4, align 8
+  %str.long = icmp slt i64 %str.length.field, 0
+  %str.heap = load ptr, ptr %3, align 8
+  %str.chars = select i1 %str.long, ptr %str.heap, ptr %3
   %5 = load double, ptr %d, align 8
-  %6 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, ptr %4, double %5)
+  %6 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, ptr %str.chars, double %5)
   ret void
 }
 
@@ -81,15 +82,17 @@ define private void @_Z15lambda.L12C41.06Stringb(%struct.String %0, i1 %1) {
   %b = alloca i1, align 1
   store %struct.String %0, ptr %str, align 8
   store i1 %1, ptr %b, align 1
-  %3 = load ptr, ptr %str, align 8
+  %3 = getelementptr inbounds nuw %struct.String, ptr %str, i32 0, i32 2
+  %str.length.field = load i64, ptr %3, align 8
+  %str.long = icmp slt i64 %str.length.field, 0
+  %str.heap = load ptr, ptr %str, align 8
+  %str.chars = select i1 %str.long, ptr %str.heap, ptr %str
   %4 = load i1, ptr %b, align 1
   %5 = zext i1 %4 to i32
-  %6 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.2, ptr %3, i32 %5)
+  %6 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.2, ptr %str.chars, i32 %5)
   ret void
 }
 
-declare void @_ZN6String4ctorERK6String(ptr, ptr)
-
 declare void @_ZN6String4dtorEv(ptr)
 
 attributes #0 = { noinline nounwind optnone uwtable }
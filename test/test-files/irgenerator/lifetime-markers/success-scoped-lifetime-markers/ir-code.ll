@@ -0,0 +1,73 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+@printf.str.0 = private unnamed_addr constant [8 x i8] c"Sum: %d\00", align 1
+
+; Function Attrs: noinline nounwind optnone uwtable
+define dso_local i32 @main() #0 {
+  %result = alloca i32, align 4
+  %sum = alloca i32, align 4
+  %i = alloca i32, align 4
+  %square = alloca i32, align 4
+  call void @llvm.lifetime.start.p0(i64 4, ptr %result)
+  store i32 0, ptr %result, align 4
+  call void @llvm.lifetime.start.p0(i64 4, ptr %sum)
+  store i32 0, ptr %sum, align 4
+  call void @llvm.lifetime.start.p0(i64 4, ptr %i)
+  store i32 0, ptr %i, align 4
+  br label %for.head.L3
+
+for.head.L3:                                      ; preds = %for.tail.L3, %0
+  %1 = load i32, ptr %i, align 4
+  %2 = icmp slt i32 %1, 3
+  br i1 %2, label %for.body.L3, label %for.exit.L3
+
+for.body.L3:                                      ; preds = %for.head.L3
+  %3 = load i32, ptr %i, align 4
+  %4 = load i32, ptr %i, align 4
+  %5 = mul nsw i32 %4, %3
+  call void @llvm.lifetime.start.p0(i64 4, ptr %square)
+  store i32 %5, ptr %square, align 4
+  %6 = load i32, ptr %square, align 4
+  %7 = load i32, ptr %sum, align 4
+  %8 = add nsw i32 %7, %6
+  store i32 %8, ptr %sum, align 4
+  call void @llvm.lifetime.end.p0(i64 4, ptr %square)
+  br label %for.tail.L3
+
+for.tail.L3:                                      ; preds = %for.body.L3
+  %9 = load i32, ptr %i, align 4
+  %10 = add nsw i32 %9, 1
+  store i32 %10, ptr %i, align 4
+  br label %for.head.L3
+
+for.exit.L3:                                      ; preds = %for.head.L3
+  call void @llvm.lifetime.end.p0(i64 4, ptr %i)
+  %11 = load i32, ptr %sum, align 4
+  %12 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 %11)
+  call void @llvm.lifetime.end.p0(i64 4, ptr %sum)
+  %13 = load i32, ptr %result, align 4
+  ret i32 %13
+}
+
+; Function Attrs: nocallback nofree nosync nounwind willreturn memory(argmem: readwrite)
+declare void @llvm.lifetime.start.p0(i64 immarg, ptr nocapture) #1
+
+; Function Attrs: nocallback nofree nosync nounwind willreturn memory(argmem: readwrite)
+declare void @llvm.lifetime.end.p0(i64 immarg, ptr nocapture) #1
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr nocapture noundef readonly, ...) #2
+
+attributes #0 = { noinline nounwind optnone uwtable }
+attributes #1 = { nocallback nofree nosync nounwind willreturn memory(argmem: readwrite) }
+attributes #2 = { nofree nounwind }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
\ No newline at end of file
@@ -0,0 +1,60 @@
+
+; Function Attrs: nofree nounwind
+define dso_local void @_Z8printAllR6VectorIiE(ptr nocapture noundef nonnull readonly align 8 dereferenceable(40) %0) local_unnamed_addr #1 {
+  %2 = getelementptr inbounds nuw i8, ptr %0, i64 16
+  %3 = load i64, ptr %2, align 8, !tbaa !5
+  %.not3 = icmp eq i64 %3, 0
+  br i1 %.not3, label %for.exit.L4, label %for.body.L4
+
+for.body.L4:                                      ; preds = %1, %for.body.L4
+  %i.04 = phi i64 [ %8, %for.body.L4 ], [ 0, %1 ]
+  %4 = load ptr, ptr %0, align 8, !tbaa !5
+  %5 = getelementptr inbounds nuw i32, ptr %4, i64 %i.04
+  %6 = load i32, ptr %5, align 4, !tbaa !5
+  %7 = tail call i32 (ptr, ...) @printf(ptr noundef nonnull dereferenceable(1) @printf.str.0, i32 %6)
+  %8 = add nuw i64 %i.04, 1
+  %9 = load i64, ptr %2, align 8, !tbaa !5
+  %10 = icmp ult i64 %8, %9
+  br i1 %10, label %for.body.L4, label %for.exit.L4
+
+for.exit.L4:                                      ; preds = %for.body.L4, %1
+  ret void
+}
+
+; Function Attrs: nounwind
+define dso_local void @_Z10printFirstR6VectorIiEm(ptr nocapture noundef nonnull readonly align 8 dereferenceable(40) %0, i64 noundef %1) local_unnamed_addr #2 {
+  %3 = alloca %struct.Error, align 8
+  %.not4 = icmp eq i64 %1, 0
+  br i1 %.not4, label %for.exit.L10, label %for.body.L10.lr.ph
+
+for.body.L10.lr.ph:                               ; preds = %2
+  %4 = getelementptr inbounds nuw i8, ptr %0, i64 16
+  %5 = getelementptr inbounds nuw i8, ptr %3, i64 8
+  br label %for.body.L10
+
+for.body.L10:                                     ; preds = %for.body.L10.lr.ph, %if.exit.L227
+  %i.05 = phi i64 [ 0, %for.body.L10.lr.ph ], [ %14, %if.exit.L227 ]
+  %6 = load i64, ptr %4, align 8, !tbaa !5
+  %.not = icmp ult i64 %i.05, %6
+  br i1 %.not, label %if.exit.L227, label %if.then.L227
+
+if.then.L227:                                     ; preds = %for.body.L10
+  %7 = load ptr, ptr @stderr, align 8
+  call void @_ZN5Error4ctorEPKc(ptr noundef nonnull align 8 dereferenceable(16) %3, ptr nonnull @anon.string.1)
+  %8 = load ptr, ptr %5, align 8
+  %9 = call i32 (ptr, ptr, ...) @fprintf(ptr %7, ptr nonnull @anon.string.0, ptr %8) #5
+  call void @exit(i32 1)
+  unreachable
+
+if.exit.L227:                                     ; preds = %for.body.L10
+  %10 = load ptr, ptr %0, align 8, !tbaa !5
+  %11 = getelementptr inbounds nuw i32, ptr %10, i64 %i.05
+  %12 = load i32, ptr %11, align 4, !tbaa !5
+  %13 = tail call i32 (ptr, ...) @printf(ptr noundef nonnull dereferenceable(1) @printf.str.1, i32 %12)
+  %14 = add nuw i64 %i.05, 1
+  %exitcond.not = icmp eq i64 %14, %1
+  br i1 %exitcond.not, label %for.exit.L10, label %for.body.L10
+
+for.exit.L10:                                     ; preds = %if.exit.L227, %2
+  ret void
+}
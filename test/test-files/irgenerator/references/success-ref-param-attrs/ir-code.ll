@@ -0,0 +1,98 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+%struct.Vec3 = type { i64, i64, i64 }
+
+@printf.str.0 = private unnamed_addr constant [19 x i8] c"Result: %d, %d, %d\00", align 1
+
+define private void @_ZN4Vec34plusERK4Vec3(ptr noundef nonnull align 8 dereferenceable(24) %0, ptr noalias nonnull sret(%struct.Vec3) align 8 %result, ptr noundef nonnull align 8 dereferenceable(24) %1) {
+  %this = alloca ptr, align 8
+  %other = alloca ptr, align 8
+  store ptr %0, ptr %this, align 8, !tbaa !5
+  store ptr %1, ptr %other, align 8, !tbaa !5
+  %x_addr = getelementptr inbounds %struct.Vec3, ptr %result, i64 0, i32 0
+  %3 = load ptr, ptr %this, align 8, !tbaa !5
+  %x_addr1 = getelementptr inbounds %struct.Vec3, ptr %3, i64 0, i32 0
+  %4 = load ptr, ptr %other, align 8, !tbaa !5
+  %x_addr2 = getelementptr inbounds %struct.Vec3, ptr %4, i64 0, i32 0
+  %5 = load i64, ptr %x_addr2, align 8, !tbaa !9
+  %6 = load i64, ptr %x_addr1, align 8, !tbaa !9
+  %7 = add nsw i64 %6, %5
+  store i64 %7, ptr %x_addr, align 8, !tbaa !9
+  %y_addr = getelementptr inbounds %struct.Vec3, ptr %result, i64 0, i32 1
+  %8 = load ptr, ptr %this, align 8, !tbaa !5
+  %y_addr3 = getelementptr inbounds %struct.Vec3, ptr %8, i64 0, i32 1
+  %9 = load ptr, ptr %other, align 8, !tbaa !5
+  %y_addr4 = getelementptr inbounds %struct.Vec3, ptr %9, i64 0, i32 1
+  %10 = load i64, ptr %y_addr4, align 8, !tbaa !9
+  %11 = load i64, ptr %y_addr3, align 8, !tbaa !9
+  %12 = add nsw i64 %11, %10
+  store i64 %12, ptr %y_addr, align 8, !tbaa !9
+  %z_addr = getelementptr inbounds %struct.Vec3, ptr %result, i64 0, i32 2
+  %13 = load ptr, ptr %this, align 8, !tbaa !5
+  %z_addr5 = getelementptr inbounds %struct.Vec3, ptr %13, i64 0, i32 2
+  %14 = load ptr, ptr %other, align 8, !tbaa !5
+  %z_addr6 = getelementptr inbounds %struct.Vec3, ptr %14, i64 0, i32 2
+  %15 = load i64, ptr %z_addr6, align 8, !tbaa !9
+  %16 = load i64, ptr %z_addr5, align 8, !tbaa !9
+  %17 = add nsw i64 %16, %15
+  store i64 %17, ptr %z_addr, align 8, !tbaa !9
+  ret void
+}
+
+define private void @_Z5scaleR4Vec3(ptr noundef nonnull align 8 dereferenceable(24) %0) {
+  %vec = alloca ptr, align 8
+  store ptr %0, ptr %vec, align 8, !tbaa !5
+  %2 = load ptr, ptr %vec, align 8, !tbaa !5
+  %x_addr = getelementptr inbounds %struct.Vec3, ptr %2, i64 0, i32 0
+  %3 = load i64, ptr %x_addr, align 8, !tbaa !9
+  %4 = mul nsw i64 %3, 2
+  store i64 %4, ptr %x_addr, align 8, !tbaa !9
+  ret void
+}
+
+; Function Attrs: noinline nounwind uwtable
+define dso_local i32 @main() #0 {
+  %result = alloca i32, align 4
+  %a = alloca %struct.Vec3, align 8
+  %b = alloca %struct.Vec3, align 8
+  %c = alloca %struct.Vec3, align 8
+  store i32 0, ptr %result, align 4, !tbaa !10
+  store %struct.Vec3 { i64 1, i64 2, i64 3 }, ptr %a, align 8
+  store %struct.Vec3 { i64 4, i64 5, i64 6 }, ptr %b, align 8
+  call void @_ZN4Vec34plusERK4Vec3(ptr noundef nonnull align 8 dereferenceable(24) %a, ptr sret(%struct.Vec3) %c, ptr %b)
+  call void @_Z5scaleR4Vec3(ptr %c)
+  %x_addr = getelementptr inbounds %struct.Vec3, ptr %c, i64 0, i32 0
+  %1 = load i64, ptr %x_addr, align 8, !tbaa !12
+  %y_addr = getelementptr inbounds %struct.Vec3, ptr %c, i64 0, i32 1
+  %2 = load i64, ptr %y_addr, align 8, !tbaa !12
+  %z_addr = getelementptr inbounds %struct.Vec3, ptr %c, i64 0, i32 2
+  %3 = load i64, ptr %z_addr, align 8, !tbaa !12
+  %4 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i64 %1, i64 %2, i64 %3)
+  %5 = load i32, ptr %result, align 4, !tbaa !10
+  ret i32 %5
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr nocapture noundef readonly, ...) #1
+
+attributes #0 = { noinline nounwind uwtable }
+attributes #1 = { nofree nounwind }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
+!5 = !{!6, !6, i64 0}
+!6 = !{!"any pointer", !7, i64 0}
+!7 = !{!"omnipotent char", !8, i64 0}
+!8 = !{!"Spice TBAA"}
+!9 = !{!7, !7, i64 0}
+!10 = !{!11, !11, i64 0}
+!11 = !{!"int", !7, i64 0}
+!12 = !{!13, !13, i64 0}
+!13 = !{!"long", !7, i64 0}
\ No newline at end of file
@@ -27,17 +27,16 @@ define private void @_ZN20StructWithHeapFields4ctorEv(ptr noundef nonnull align
   %2 = load ptr, ptr %this, align 8
   %3 = getelementptr inbounds %struct.StructWithHeapFields, ptr %2, i64 0, i32 0
   store ptr null, ptr %3, align 8
-  %4 = call %struct.Result @_Z6sAllocm(i64 10)
-  store %struct.Result %4, ptr %res, align 8
-  %5 = load ptr, ptr %this, align 8
-  %data_addr = getelementptr inbounds %struct.StructWithHeapFields, ptr %5, i64 0, i32 0
-  %6 = call ptr @_ZN6ResultIPhE6unwrapEv(ptr noundef nonnull align 8 dereferenceable(24) %res)
-  %7 = load ptr, ptr %6, align 8
-  store ptr %7, ptr %data_addr, align 8
+  call void @_Z6sAllocm(ptr sret(%struct.Result) %res, i64 10)
+  %4 = load ptr, ptr %this, align 8
+  %data_addr = getelementptr inbounds %struct.StructWithHeapFields, ptr %4, i64 0, i32 0
+  %5 = call ptr @_ZN6ResultIPhE6unwrapEv(ptr noundef nonnull align 8 dereferenceable(24) %res)
+  %6 = load ptr, ptr %5, align 8
+  store ptr %6, ptr %data_addr, align 8
   ret void
 }
 
-declare %struct.Result @_Z6sAllocm(i64)
+declare void @_Z6sAllocm(ptr, i64)
 
 declare ptr @_ZN6ResultIPhE6unwrapEv(ptr)
 
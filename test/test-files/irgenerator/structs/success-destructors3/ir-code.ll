@@ -14,8 +14,12 @@ define private void @_Z4testv() {
   call void @_ZN6String4ctorEPKc(ptr noundef nonnull align 8 dereferenceable(24) %1, ptr @anon.string.0)
   store ptr %1, ptr %t, align 8
   %2 = load ptr, ptr %t, align 8
-  %3 = load ptr, ptr %2, align 8
-  %4 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, ptr %3)
+  %3 = getelementptr inbounds nuw %struct.String, ptr %2, i32 0, i32 2
+  %str.length.field = load i64, ptr %3, align 8
+  %str.long = icmp slt i64 %str.length.field, 0
+  %str.heap = load ptr, ptr %2, align 8
+  %str.chars = select i1 %str.long, ptr %str.heap, ptr %2
+  %4 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, ptr %str.chars)
   call void @_ZN6String4dtorEv(ptr %1)
   ret void
 }
@@ -31,8 +35,12 @@ define private void @_Z4testRK6String(ptr %0) {
   %t = alloca ptr, align 8
   store ptr %0, ptr %t, align 8
   %2 = load ptr, ptr %t, align 8
-  %3 = load ptr, ptr %2, align 8
-  %4 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, ptr %3)
+  %3 = getelementptr inbounds nuw %struct.String, ptr %2, i32 0, i32 2
+  %str.length.field = load i64, ptr %3, align 8
+  %str.long = icmp slt i64 %str.length.field, 0
+  %str.heap = load ptr, ptr %2, align 8
+  %str.chars = select i1 %str.long, ptr %str.heap, ptr %2
+  %4 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, ptr %str.chars)
   ret void
 }
 
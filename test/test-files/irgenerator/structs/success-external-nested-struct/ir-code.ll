@@ -13,21 +13,20 @@ define dso_local i32 @main() #0 {
   %s = alloca %struct.Socket, align 8
   %n = alloca %struct.NestedSocket, align 8
   store i32 0, ptr %result, align 4
-  %1 = call %struct.Socket @_Z16openServerSockett(i16 8080)
-  store %struct.Socket %1, ptr %s, align 8
+  call void @_Z16openServerSockett(ptr sret(%struct.Socket) %s, i16 8080)
   %nested_addr = getelementptr inbounds %struct.Socket, ptr %s, i64 0, i32 2
   call void @llvm.memcpy.p0.p0.i64(ptr %n, ptr %nested_addr, i64 16, i1 false)
   %testString_addr = getelementptr inbounds %struct.NestedSocket, ptr %n, i64 0, i32 0
-  %2 = load ptr, ptr %testString_addr, align 8
-  %3 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, ptr %2)
+  %1 = load ptr, ptr %testString_addr, align 8
+  %2 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, ptr %1)
   %sock_addr = getelementptr inbounds %struct.Socket, ptr %s, i64 0, i32 0
-  %4 = load i32, ptr %sock_addr, align 4
-  %5 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, i32 %4)
-  %6 = load i32, ptr %result, align 4
-  ret i32 %6
+  %3 = load i32, ptr %sock_addr, align 4
+  %4 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.1, i32 %3)
+  %5 = load i32, ptr %result, align 4
+  ret i32 %5
 }
 
-declare %struct.Socket @_Z16openServerSockett(i16)
+declare void @_Z16openServerSockett(ptr, i16)
 
 ; Function Attrs: nocallback nofree nounwind willreturn memory(argmem: readwrite)
 declare void @llvm.memcpy.p0.p0.i64(ptr noalias nocapture writeonly, ptr noalias nocapture readonly, i64, i1 immarg) #1
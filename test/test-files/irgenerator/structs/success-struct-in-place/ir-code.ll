@@ -24,8 +24,7 @@ source_filename = "source.spice"
 @printf.str.0 = private unnamed_addr constant [26 x i8] c"Shopping cart item 1: %s\0A\00", align 1
 @printf.str.1 = private unnamed_addr constant [30 x i8] c"Another cart item 2 unit: %s\0A\00", align 1
 
-define private %struct.ShoppingCart @_Z15newShoppingCartv() {
-  %result = alloca %struct.ShoppingCart, align 8
+define private void @_Z15newShoppingCartv(ptr noalias nonnull sret(%struct.ShoppingCart) align 8 %result) {
   %items = alloca [3 x %struct.ShoppingItem], align 8
   %1 = alloca %struct.ShoppingCart, align 8
   store [3 x %struct.ShoppingItem] [%struct.ShoppingItem { ptr @0, double 0.000000e+00, ptr @1 }, %struct.ShoppingItem { ptr @0, double 0.000000e+00, ptr @1 }, %struct.ShoppingItem { ptr @0, double 0.000000e+00, ptr @1 }], ptr %items, align 8
@@ -39,12 +38,14 @@ define private %struct.ShoppingCart @_Z15newShoppingCartv() {
   %5 = load [3 x %struct.ShoppingItem], ptr %items, align 8
   %6 = getelementptr inbounds nuw %struct.ShoppingCart, ptr %1, i32 0, i32 1
   store [3 x %struct.ShoppingItem] %5, ptr %6, align 8
-  %7 = load %struct.ShoppingCart, ptr %1, align 8
-  ret %struct.ShoppingCart %7
+  call void @llvm.memcpy.p0.p0.i64(ptr %result, ptr %1, i64 80, i1 false)
+  ret void
 }
 
-define private %struct.ShoppingCart @_Z19anotherShoppingCartv() {
-  %result = alloca %struct.ShoppingCart, align 8
+; Function Attrs: nocallback nofree nounwind willreturn memory(argmem: readwrite)
+declare void @llvm.memcpy.p0.p0.i64(ptr noalias nocapture writeonly, ptr noalias nocapture readonly, i64, i1 immarg) #0
+
+define private void @_Z19anotherShoppingCartv(ptr noalias nonnull sret(%struct.ShoppingCart) align 8 %result) {
   %items = alloca [3 x %struct.ShoppingItem], align 8
   %1 = alloca %struct.ShoppingCart, align 8
   store [3 x %struct.ShoppingItem] [%struct.ShoppingItem { ptr @anon.string.7, double 1.000000e+02, ptr @anon.string.8 }, %struct.ShoppingItem { ptr @anon.string.9, double 1.255000e+02, ptr @anon.string.10 }, %struct.ShoppingItem { ptr @anon.string.11, double 6.000000e+00, ptr @anon.string.12 }], ptr %items, align 8
@@ -52,23 +53,24 @@ define private %struct.ShoppingCart @_Z19anotherShoppingCartv() {
   %2 = load [3 x %struct.ShoppingItem], ptr %items, align 8
   %3 = getelementptr inbounds nuw %struct.ShoppingCart, ptr %1, i32 0, i32 1
   store [3 x %struct.ShoppingItem] %2, ptr %3, align 8
-  %4 = load %struct.ShoppingCart, ptr %1, align 8
-  ret %struct.ShoppingCart %4
+  call void @llvm.memcpy.p0.p0.i64(ptr %result, ptr %1, i64 80, i1 false)
+  ret void
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define dso_local i32 @main() #0 {
+define dso_local i32 @main() #1 {
   %result = alloca i32, align 4
   %shoppingCart = alloca %struct.ShoppingCart, align 8
+  %1 = alloca %struct.ShoppingCart, align 8
   store i32 0, ptr %result, align 4
-  %1 = call %struct.ShoppingCart @_Z15newShoppingCartv()
-  store %struct.ShoppingCart %1, ptr %shoppingCart, align 8
+  call void @_Z15newShoppingCartv(ptr sret(%struct.ShoppingCart) %shoppingCart)
   %items_addr = getelementptr inbounds %struct.ShoppingCart, ptr %shoppingCart, i64 0, i32 1
   %2 = getelementptr inbounds [3 x %struct.ShoppingItem], ptr %items_addr, i64 0, i32 1
   %name_addr = getelementptr inbounds %struct.ShoppingItem, ptr %2, i64 0, i32 0
   %3 = load ptr, ptr %name_addr, align 8
   %4 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, ptr %3)
-  %5 = call %struct.ShoppingCart @_Z19anotherShoppingCartv()
+  call void @_Z19anotherShoppingCartv(ptr sret(%struct.ShoppingCart) %1)
+  %5 = load %struct.ShoppingCart, ptr %1, align 8
   store %struct.ShoppingCart %5, ptr %shoppingCart, align 8
   %items_addr1 = getelementptr inbounds %struct.ShoppingCart, ptr %shoppingCart, i64 0, i32 1
   %6 = getelementptr inbounds [3 x %struct.ShoppingItem], ptr %items_addr1, i64 0, i32 2
@@ -80,10 +82,11 @@ define dso_local i32 @main() #0 {
 }
 
 ; Function Attrs: nofree nounwind
-declare noundef i32 @printf(ptr nocapture noundef readonly, ...) #1
+declare noundef i32 @printf(ptr nocapture noundef readonly, ...) #2
 
-attributes #0 = { noinline nounwind optnone uwtable }
-attributes #1 = { nofree nounwind }
+attributes #0 = { nocallback nofree nounwind willreturn memory(argmem: readwrite) }
+attributes #1 = { noinline nounwind optnone uwtable }
+attributes #2 = { nofree nounwind }
 
 !llvm.module.flags = !{!0, !1, !2, !3}
 !llvm.ident = !{!4}
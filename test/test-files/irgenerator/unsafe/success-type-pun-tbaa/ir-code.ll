@@ -0,0 +1,46 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+@printf.str.0 = private unnamed_addr constant [12 x i8] c"Is one: %d\0A\00", align 1
+
+define private i64 @_Z7getBitsd(double %0) {
+  %result = alloca i64, align 8
+  %input = alloca double, align 8
+  store double %0, ptr %input, align 8, !tbaa !5
+  %2 = load i64, ptr %input, align 8, !tbaa !9
+  ret i64 %2
+}
+
+; Function Attrs: noinline nounwind uwtable
+define dso_local i32 @main() #0 {
+  %result = alloca i32, align 4
+  store i32 0, ptr %result, align 4, !tbaa !10
+  %1 = call i64 @_Z7getBitsd(double 1.000000e+00)
+  %2 = icmp eq i64 %1, 4607182418800017408
+  %3 = zext i1 %2 to i32
+  %4 = call i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 %3)
+  %5 = load i32, ptr %result, align 4, !tbaa !10
+  ret i32 %5
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr nocapture noundef readonly, ...) #1
+
+attributes #0 = { noinline nounwind uwtable }
+attributes #1 = { nofree nounwind }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
+!5 = !{!6, !6, i64 0}
+!6 = !{!"double", !7, i64 0}
+!7 = !{!"omnipotent char", !8, i64 0}
+!8 = !{!"Spice TBAA"}
+!9 = !{!7, !7, i64 0}
+!10 = !{!11, !11, i64 0}
+!11 = !{!"int", !7, i64 0}
\ No newline at end of file
@@ -0,0 +1,97 @@
+// Copyright (c) 2021-2025 ChilliBits. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <llvm/IR/Constants.h>
+
+#include <iroptimizer/passes/BoundsCheckElimPass.h>
+
+#include "util/PassTestUtil.h"
+
+namespace spice::testing {
+
+using namespace spice::compiler;
+
+static constexpr const char *const BOUNDS_CHECK_MODULE = R"(
+define void @checkInCountedLoop(ptr %array) {
+entry:
+  br label %loop.head
+
+loop.head:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %in.bounds ]
+  %loop.cond = icmp ult i64 %i, 10
+  br i1 %loop.cond, label %loop.body, label %loop.exit
+
+loop.body:
+  %out.of.bounds = icmp uge i64 %i, 10
+  br i1 %out.of.bounds, label %panic, label %in.bounds
+
+panic:
+  call void @exit(i32 1)
+  unreachable
+
+in.bounds:
+  %item.addr = getelementptr inbounds [10 x i32], ptr %array, i64 0, i64 %i
+  store i32 0, ptr %item.addr, align 4
+  %i.next = add nuw nsw i64 %i, 1
+  br label %loop.head
+
+loop.exit:
+  ret void
+}
+
+define void @checkBeyondLoopBound(ptr %array) {
+entry:
+  br label %loop.head
+
+loop.head:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %in.bounds ]
+  %loop.cond = icmp ult i64 %i, 10
+  br i1 %loop.cond, label %loop.body, label %loop.exit
+
+loop.body:
+  %out.of.bounds = icmp uge i64 %i, 8
+  br i1 %out.of.bounds, label %panic, label %in.bounds
+
+panic:
+  call void @exit(i32 1)
+  unreachable
+
+in.bounds:
+  %item.addr = getelementptr inbounds [8 x i32], ptr %array, i64 0, i64 %i
+  store i32 0, ptr %item.addr, align 4
+  %i.next = add nuw nsw i64 %i, 1
+  br label %loop.head
+
+loop.exit:
+  ret void
+}
+
+declare void @exit(i32) noreturn
+)";
+
+static const llvm::Value *getCheckCondition(const llvm::Function &function) {
+  for (const llvm::BasicBlock &block : function)
+    if (block.getName() == "loop.body")
+      return llvm::cast<llvm::BranchInst>(block.getTerminator())->getCondition();
+  return nullptr;
+}
+
+class BoundsCheckElimPassTest : public FunctionPassTest {
+protected:
+  BoundsCheckElimPassTest() : FunctionPassTest(BOUNDS_CHECK_MODULE) {}
+};
+
+TEST_F(BoundsCheckElimPassTest, TestRemoveCheckInCountedLoop) {
+  const llvm::Function &function = runPass<BoundsCheckElimPass>("checkInCountedLoop");
+  const auto *condition = llvm::dyn_cast<llvm::ConstantInt>(getCheckCondition(function));
+  ASSERT_NE(nullptr, condition);
+  ASSERT_TRUE(condition->isZero()); // Never take the panic path
+}
+
+TEST_F(BoundsCheckElimPassTest, TestKeepCheckBeyondLoopBound) {
+  const llvm::Function &function = runPass<BoundsCheckElimPass>("checkBeyondLoopBound");
+  ASSERT_TRUE(llvm::isa<llvm::ICmpInst>(getCheckCondition(function)));
+}
+
+} // namespace spice::testing
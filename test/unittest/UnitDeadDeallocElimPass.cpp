@@ -0,0 +1,69 @@
+// Copyright (c) 2021-2025 ChilliBits. All rights reserved.
+
+#include <gtest/gtest.h>
+
+
+#include <iroptimizer/passes/DeadDeallocElimPass.h>
+
+#include "util/PassTestUtil.h"
+
+namespace spice::testing {
+
+using namespace spice::compiler;
+
+static constexpr const char *const DEAD_DEALLOC_MODULE = R"(
+define void @deallocTwice(ptr %slot) {
+  call void @_Z8sDeallocRPh(ptr %slot)
+  call void @_Z8sDeallocRPh(ptr %slot)
+  ret void
+}
+
+define void @deallocNil() {
+  %slot = alloca ptr, align 8
+  store ptr null, ptr %slot, align 8
+  call void @_Z8sDeallocRPh(ptr %slot)
+  ret void
+}
+
+define void @deallocAfterWrite(ptr %slot) {
+  call void @_Z8sDeallocRPh(ptr %slot)
+  call void @_Z5resetRPh(ptr %slot)
+  call void @_Z8sDeallocRPh(ptr %slot)
+  ret void
+}
+
+declare void @_Z8sDeallocRPh(ptr)
+declare void @_Z5resetRPh(ptr)
+)";
+
+static size_t countDeallocCalls(const llvm::Function &function) {
+  size_t count = 0;
+  for (const llvm::BasicBlock &block : function)
+    for (const llvm::Instruction &inst : block)
+      if (const auto *call = llvm::dyn_cast<llvm::CallInst>(&inst))
+        if (call->getCalledFunction() && call->getCalledFunction()->getName() == "_Z8sDeallocRPh")
+          count++;
+  return count;
+}
+
+class DeadDeallocElimPassTest : public FunctionPassTest {
+protected:
+  DeadDeallocElimPassTest() : FunctionPassTest(DEAD_DEALLOC_MODULE) {}
+};
+
+TEST_F(DeadDeallocElimPassTest, TestRemoveSecondDealloc) {
+  const llvm::Function &function = runPass<DeadDeallocElimPass>("deallocTwice");
+  ASSERT_EQ(1u, countDeallocCalls(function));
+}
+
+TEST_F(DeadDeallocElimPassTest, TestRemoveDeallocOfNil) {
+  const llvm::Function &function = runPass<DeadDeallocElimPass>("deallocNil");
+  ASSERT_EQ(0u, countDeallocCalls(function));
+}
+
+TEST_F(DeadDeallocElimPassTest, TestKeepDeallocAfterWrite) {
+  const llvm::Function &function = runPass<DeadDeallocElimPass>("deallocAfterWrite");
+  ASSERT_EQ(2u, countDeallocCalls(function));
+}
+
+} // namespace spice::testing
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <driver/Driver.h>
+#include <exception/CliError.h>
 
 namespace spice::testing {
 
@@ -27,6 +28,7 @@ TEST(DriverTest, TestBuildSubcommandMinimal) {
   ASSERT_FALSE(driver.cliOptions.generateTestMain);
   ASSERT_FALSE(driver.cliOptions.testMode);
   ASSERT_FALSE(driver.cliOptions.noEntryFct);
+  ASSERT_FALSE(driver.cliOptions.useLifetimeMarkers);
 }
 
 TEST(DriverTest, TestBuildSubcommandComplex) {
@@ -52,6 +54,30 @@ TEST(DriverTest, TestBuildSubcommandComplex) {
   ASSERT_TRUE(driver.cliOptions.useLTO);              // -lto
   ASSERT_TRUE(driver.cliOptions.printDebugOutput);    // -d
   ASSERT_TRUE(driver.cliOptions.dumpSettings.dumpIR); // -ir
+  ASSERT_TRUE(driver.cliOptions.useLifetimeMarkers);  // implied by -Os
+}
+
+TEST(DriverTest, TestBuildSubcommandPGO) {
+  const char *argv[] = {"spice", "b", "-O3", "--pgo-instr-gen", "../../media/test-project/test.spice"};
+  static constexpr int argc = std::size(argv);
+  Driver driver(true);
+  driver.init();
+  ASSERT_EQ(EXIT_SUCCESS, driver.parse(argc, argv));
+  driver.enrich();
+
+  ASSERT_TRUE(driver.shouldCompile);
+  ASSERT_EQ(O3, driver.cliOptions.optLevel);  // -O3
+  ASSERT_TRUE(driver.cliOptions.pgoInstrGen); // --pgo-instr-gen
+  ASSERT_TRUE(driver.cliOptions.pgoProfileUsePath.empty());
+}
+
+TEST(DriverTest, TestBuildSubcommandPGOWithoutOptimization) {
+  const char *argv[] = {"spice", "b", "--pgo-instr-gen", "../../media/test-project/test.spice"};
+  static constexpr int argc = std::size(argv);
+  Driver driver(true);
+  driver.init();
+  ASSERT_EQ(EXIT_SUCCESS, driver.parse(argc, argv));
+  ASSERT_THROW(driver.enrich(), CliError);
 }
 
 TEST(DriverTest, TestRunSubcommandMinimal) {
@@ -0,0 +1,107 @@
+// Copyright (c) 2021-2025 ChilliBits. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <llvm/IR/IntrinsicInst.h>
+
+#include <iroptimizer/passes/StringCopyElisionPass.h>
+
+#include "util/PassTestUtil.h"
+
+namespace spice::testing {
+
+using namespace spice::compiler;
+
+static constexpr const char *const STRING_COPY_MODULE = R"(
+%struct.String = type { ptr, i64, i64 }
+
+@str = private unnamed_addr constant [6 x i8] c"Hello\00", align 1
+
+define void @copyCtorResult() {
+  %s = alloca %struct.String, align 8
+  %tmp = alloca %struct.String, align 8
+  call void @_ZN6String4ctorEPKc(ptr %tmp, ptr @str)
+  call void @_ZN6String4ctorERK6String(ptr %s, ptr %tmp)
+  call void @_ZN6String4dtorEv(ptr %tmp)
+  call void @_ZN6String4dtorEv(ptr %s)
+  ret void
+}
+
+define void @copySRetResult() {
+  %s = alloca %struct.String, align 8
+  %tmp = alloca %struct.String, align 8
+  call void @llvm.lifetime.start.p0(i64 24, ptr %tmp)
+  call void @_Z9getStringv(ptr sret(%struct.String) %tmp)
+  call void @_ZN6String4ctorERK6String(ptr %s, ptr %tmp)
+  call void @_ZN6String4dtorEv(ptr %tmp)
+  call void @llvm.lifetime.end.p0(i64 24, ptr %tmp)
+  call void @_ZN6String4dtorEv(ptr %s)
+  ret void
+}
+
+define void @copyUsedSource() {
+  %s = alloca %struct.String, align 8
+  %tmp = alloca %struct.String, align 8
+  call void @_Z9getStringv(ptr sret(%struct.String) %tmp)
+  call void @_ZN6String4ctorERK6String(ptr %s, ptr %tmp)
+  call void @_Z5printRK6String(ptr %tmp)
+  call void @_ZN6String4dtorEv(ptr %tmp)
+  call void @_ZN6String4dtorEv(ptr %s)
+  ret void
+}
+
+declare void @_ZN6String4ctorEPKc(ptr, ptr)
+declare void @_ZN6String4ctorERK6String(ptr, ptr)
+declare void @_ZN6String4dtorEv(ptr)
+declare void @_Z9getStringv(ptr sret(%struct.String))
+declare void @_Z5printRK6String(ptr)
+declare void @llvm.lifetime.start.p0(i64 immarg, ptr nocapture)
+declare void @llvm.lifetime.end.p0(i64 immarg, ptr nocapture)
+)";
+
+static size_t countCallsTo(const llvm::Function &function, const char *fctName) {
+  size_t count = 0;
+  for (const llvm::BasicBlock &block : function)
+    for (const llvm::Instruction &inst : block)
+      if (const auto *call = llvm::dyn_cast<llvm::CallInst>(&inst))
+        if (call->getCalledFunction() && call->getCalledFunction()->getName() == fctName)
+          count++;
+  return count;
+}
+
+static size_t countMemCpys(const llvm::Function &function) {
+  size_t count = 0;
+  for (const llvm::BasicBlock &block : function)
+    for (const llvm::Instruction &inst : block)
+      if (llvm::isa<llvm::MemCpyInst>(&inst))
+        count++;
+  return count;
+}
+
+class StringCopyElisionPassTest : public FunctionPassTest {
+protected:
+  StringCopyElisionPassTest() : FunctionPassTest(STRING_COPY_MODULE) {}
+};
+
+TEST_F(StringCopyElisionPassTest, TestElideCopyOfCtorResult) {
+  const llvm::Function &function = runPass<StringCopyElisionPass>("copyCtorResult");
+  ASSERT_EQ(0u, countCallsTo(function, "_ZN6String4ctorERK6String"));
+  ASSERT_EQ(1u, countCallsTo(function, "_ZN6String4dtorEv"));
+  ASSERT_EQ(1u, countMemCpys(function));
+}
+
+TEST_F(StringCopyElisionPassTest, TestElideCopyOfSRetResult) {
+  const llvm::Function &function = runPass<StringCopyElisionPass>("copySRetResult");
+  ASSERT_EQ(0u, countCallsTo(function, "_ZN6String4ctorERK6String"));
+  ASSERT_EQ(1u, countCallsTo(function, "_ZN6String4dtorEv"));
+  ASSERT_EQ(1u, countMemCpys(function));
+}
+
+TEST_F(StringCopyElisionPassTest, TestKeepCopyOfUsedSource) {
+  const llvm::Function &function = runPass<StringCopyElisionPass>("copyUsedSource");
+  ASSERT_EQ(1u, countCallsTo(function, "_ZN6String4ctorERK6String"));
+  ASSERT_EQ(2u, countCallsTo(function, "_ZN6String4dtorEv"));
+  ASSERT_EQ(0u, countMemCpys(function));
+}
+
+} // namespace spice::testing
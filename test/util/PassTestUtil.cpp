@@ -0,0 +1,29 @@
+// Copyright (c) 2021-2025 ChilliBits. All rights reserved.
+
+// GCOV_EXCL_START
+
+#include "PassTestUtil.h"
+
+#include <llvm/AsmParser/Parser.h>
+#include <llvm/Support/SourceMgr.h>
+
+namespace spice::testing {
+
+/**
+ * Parse the module under test and register all analyses, the pass under test might request
+ */
+void FunctionPassTest::SetUp() {
+  llvm::SMDiagnostic diagnostic;
+  module = llvm::parseAssemblyString(moduleAsm, diagnostic, context);
+  ASSERT_NE(nullptr, module) << diagnostic.getMessage().str();
+
+  passBuilder.registerModuleAnalyses(moduleAnalysisMgr);
+  passBuilder.registerCGSCCAnalyses(cgsccAnalysisMgr);
+  passBuilder.registerFunctionAnalyses(functionAnalysisMgr);
+  passBuilder.registerLoopAnalyses(loopAnalysisMgr);
+  passBuilder.crossRegisterProxies(loopAnalysisMgr, functionAnalysisMgr, cgsccAnalysisMgr, moduleAnalysisMgr);
+}
+
+} // namespace spice::testing
+
+// GCOV_EXCL_STOP
@@ -0,0 +1,48 @@
+// Copyright (c) 2021-2025 ChilliBits. All rights reserved.
+
+// GCOV_EXCL_START
+
+#pragma once
+
+#include <cassert>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Passes/PassBuilder.h>
+
+namespace spice::testing {
+
+/**
+ * Test fixture for running a single function pass on a module, parsed from textual LLVM IR
+ */
+class FunctionPassTest : public ::testing::Test {
+protected:
+  // Constructors
+  explicit FunctionPassTest(const char *moduleAsm) : moduleAsm(moduleAsm) {}
+
+  // Protected methods
+  void SetUp() override;
+  template <typename Pass> llvm::Function &runPass(const char *fctName) {
+    llvm::Function *function = module->getFunction(fctName);
+    assert(function != nullptr);
+    Pass().run(*function, functionAnalysisMgr);
+    return *function;
+  }
+
+  // Protected members
+  const char *moduleAsm;
+  llvm::LLVMContext context;
+  std::unique_ptr<llvm::Module> module;
+  llvm::PassBuilder passBuilder;
+  llvm::LoopAnalysisManager loopAnalysisMgr;
+  llvm::FunctionAnalysisManager functionAnalysisMgr;
+  llvm::CGSCCAnalysisManager cgsccAnalysisMgr;
+  llvm::ModuleAnalysisManager moduleAnalysisMgr;
+};
+
+} // namespace spice::testing
+
+// GCOV_EXCL_STOP
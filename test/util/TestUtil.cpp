@@ -11,6 +11,9 @@
 
 #include <gtest/gtest.h>
 
+#include <llvm/IR/Module.h>
+#include <llvm/Support/raw_ostream.h>
+
 #include "util/CommonUtil.h"
 #include "util/FileUtil.h"
 
@@ -216,6 +219,26 @@ void TestUtil::eraseLinesBySubstring(std::string &irCode, const char *const need
   }
 }
 
+/**
+ * Print the IR of the given functions only. This keeps optimized IR refs of tests, that link in large parts of the std,
+ * focused on the code under test
+ *
+ * @param module LLVM module, containing the functions
+ * @param fctNames Mangled names of the functions to print
+ * @return IR string
+ */
+std::string TestUtil::getFunctionsIRString(const llvm::Module *module, const std::vector<std::string> &fctNames) {
+  std::string output;
+  llvm::raw_string_ostream oss(output);
+  for (const std::string &fctName : fctNames) {
+    const llvm::Function *function = module->getFunction(fctName);
+    EXPECT_NE(nullptr, function) << "Function " << fctName << " not found in module";
+    if (function != nullptr)
+      function->print(oss);
+  }
+  return output;
+}
+
 } // namespace spice::testing
 
 // GCOV_EXCL_STOP
\ No newline at end of file
@@ -11,6 +11,11 @@
 
 #include <gtest/gtest.h>
 
+// Forward declarations
+namespace llvm {
+class Module;
+} // namespace llvm
+
 namespace spice::testing {
 
 const char *const PATH_TEST_FILES = "./test-files/";
@@ -24,6 +29,8 @@ extern bool skipNonGitHubTests;
 
 const char *const INPUT_NAME_LINKER_FLAGS = "linker-flags.txt";
 const char *const INPUT_NAME_CLI_FLAGS = "cli-flags.txt";
+const char *const INPUT_NAME_OPT_LEVEL = "opt-level.txt";
+const char *const INPUT_NAME_IR_FUNCTIONS = "ir-functions.txt";
 
 const char *const REF_NAME_SOURCE = "source.spice";
 const char *const REF_NAME_PARSE_TREE = "parse-tree.dot";
@@ -40,12 +47,16 @@ const char *const REF_NAME_ERROR_OUTPUT = "exception.out";
 const char *const REF_NAME_WARNING_OUTPUT = "warning.out";
 const char *const REF_NAME_EXIT_CODE = "exit-code.out";
 
+const char *const OUTPUT_NAME_PGO_PROFILE = "source.profraw";
+
 const char *const CTL_SKIP_DISABLED = "disabled";
 const char *const CTL_SKIP_GH = "skip-gh-actions";
 const char *const CTL_DEBUG_INFO = "with-debug-info";
 const char *const CTL_RUN_BUILTIN_TESTS = "run-builtin-tests";
 const char *const CTL_DEBUG_SCRIPT = "debug.gdb";
 const char *const CTL_LTO = "with-lto";
+const char *const CTL_PGO_INSTR_GEN = "with-pgo-instr-gen";
+const char *const CTL_LIFETIME_MARKERS = "with-lifetime-markers";
 
 struct TestCase {
   const std::string testSuite;
@@ -86,6 +97,7 @@ public:
   static bool isDisabled(const TestCase &testCase, bool isGHActions);
   static void eraseGDBHeader(std::string &gdbOutput);
   static void eraseLinesBySubstring(std::string &irCode, const char *needle);
+  static std::string getFunctionsIRString(const llvm::Module *module, const std::vector<std::string> &fctNames);
 };
 
 } // namespace spice::testing